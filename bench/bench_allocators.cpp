@@ -0,0 +1,75 @@
+#include "../src/dynamic_array.hpp"
+#include "../src/allocators.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+// Many short-lived arrays: build a small array, read it, drop it.
+// Default std::allocator (malloc) vs. a monotonic arena released once per batch
+// vs. a fixed-size pool whose blocks fit the largest array.
+
+template <typename F>
+long run_once(F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+const int TRIES = 5;
+
+template <typename F>
+long median_time(F fn) {
+    std::vector<long> times;
+    for (int t = 0; t < TRIES; ++t) times.push_back(run_once(fn));
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+int main() {
+    const long ARRAYS = 1000000;  // arrays built and dropped per run
+    const int ELEMS = 24;         // elements per array (grows 1,2,4,...,32)
+    const long BATCH = 1000;      // arena is released after this many arrays
+
+    std::cout << "Benchmark: ARRAYS=" << ARRAYS << " ELEMS=" << ELEMS
+              << " TRIES=" << TRIES << " (median)\n\n";
+
+    volatile long sink = 0;
+
+    long malloc_us = median_time([&]() {
+        for (long n = 0; n < ARRAYS; ++n) {
+            DynamicArray<int> a;
+            for (int i = 0; i < ELEMS; ++i) a.push_back(i);
+            sink = sink + a[ELEMS - 1];
+        }
+    });
+    std::cout << "std::allocator   median us: " << malloc_us << "\n";
+
+    long arena_us = median_time([&]() {
+        ArenaResource arena(256 * 1024);
+        ArenaAllocator<int> alloc(arena);
+        for (long n = 0; n < ARRAYS; ++n) {
+            {
+                DynamicArray<int, ArenaAllocator<int>> a(alloc);
+                for (int i = 0; i < ELEMS; ++i) a.push_back(i);
+                sink = sink + a[ELEMS - 1];
+            }
+            if (n % BATCH == BATCH - 1) arena.release();
+        }
+    });
+    std::cout << "ArenaAllocator   median us: " << arena_us << "\n";
+
+    long pool_us = median_time([&]() {
+        PoolResource pool(32 * sizeof(int), 64);
+        PoolAllocator<int> alloc(pool);
+        for (long n = 0; n < ARRAYS; ++n) {
+            DynamicArray<int, PoolAllocator<int>> a(alloc);
+            for (int i = 0; i < ELEMS; ++i) a.push_back(i);
+            sink = sink + a[ELEMS - 1];
+        }
+    });
+    std::cout << "PoolAllocator    median us: " << pool_us << "\n";
+
+    return 0;
+}
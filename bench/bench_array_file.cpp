@@ -0,0 +1,108 @@
+#include "../src/array_file.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Startup cost of a large lookup table (uint64_t entries):
+//   rebuild   compute every entry from scratch
+//   load      array_file::load into a DynamicArray
+//   mmap      MappedArrayView: open only, open + 1000 lookups, open + full scan
+// "cold" first evicts the file from the page cache (posix_fadvise DONTNEED),
+// "warm" reuses the cached pages.
+//
+//   ./bench_array_file [table_MB]      (default 1024 = 1 GB)
+
+constexpr int TRIES = 3;
+const char* PATH = "/tmp/ds_bench_array_file.bin";
+
+static std::uint64_t entry(std::uint64_t i) {
+    // splitmix64, standing in for real per-entry work
+    std::uint64_t z = i + 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static void evict() {
+    int fd = ::open(PATH, O_RDONLY);
+    if (fd < 0) return;
+    ::fdatasync(fd);
+#if defined(POSIX_FADV_DONTNEED)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    ::close(fd);
+}
+
+template <typename F>
+double median_ms(bool cold, F&& f) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) {
+        if (cold) evict();
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        t[i] = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+    std::sort(t, t + TRIES);
+    return t[TRIES / 2];
+}
+
+volatile std::uint64_t sink;
+
+int main(int argc, char** argv) {
+    std::size_t table_mb = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+    const std::size_t n = table_mb * 1024 * 1024 / sizeof(std::uint64_t);
+    std::cout << "Benchmark: " << table_mb << " MB table (" << n << " uint64_t), median of " << TRIES << " runs\n\n";
+
+    double rebuild = median_ms(false, [&]{
+        DynamicArray<std::uint64_t> t;
+        t.resize_for_overwrite(n);
+        for (std::size_t i = 0; i < n; ++i) t[i] = entry(i);
+        sink = t[n / 2];
+    });
+    std::cout << "rebuild                      " << rebuild << " ms\n";
+
+    {
+        DynamicArray<std::uint64_t> t;
+        t.resize_for_overwrite(n);
+        for (std::size_t i = 0; i < n; ++i) t[i] = entry(i);
+        if (!array_file::save(t, PATH)) { std::cout << "save failed\n"; return 1; }
+    }
+
+    for (bool cold : {true, false}) {
+        const char* tag = cold ? "cold" : "warm";
+        double load = median_ms(cold, [&]{
+            DynamicArray<std::uint64_t> t;
+            if (!array_file::load(t, PATH)) std::abort();
+            sink = t[n / 2];
+        });
+        double open_only = median_ms(cold, [&]{
+            MappedArrayView<std::uint64_t> v(PATH);
+            if (!v.is_open()) std::abort();
+            sink = v.size();
+        });
+        double lookups = median_ms(cold, [&]{
+            MappedArrayView<std::uint64_t> v(PATH);
+            std::uint64_t s = 0;
+            for (std::uint64_t i = 0; i < 1000; ++i) s += v[entry(i) % v.size()];
+            sink = s;
+        });
+        double scan = median_ms(cold, [&]{
+            MappedArrayView<std::uint64_t> v(PATH);
+            std::uint64_t s = 0;
+            for (std::uint64_t x : v) s += x;
+            sink = s;
+        });
+        std::cout << tag << " load                    " << load << " ms\n"
+                  << tag << " mmap open               " << open_only << " ms\n"
+                  << tag << " mmap + 1000 lookups     " << lookups << " ms\n"
+                  << tag << " mmap + full scan        " << scan << " ms\n";
+    }
+
+    std::remove(PATH);
+    return 0;
+}
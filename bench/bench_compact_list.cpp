@@ -0,0 +1,111 @@
+#include "../src/compact_list.hpp"
+#include "../src/doubly_linked_list.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <vector>
+
+// N ints in a CompactList<int> vs. a DoublyLinkedList<int>:
+//  - bytes per element: node bytes requested from the allocator (the heap
+//    adds its own header to each of DoublyLinkedList's allocations on top)
+//  - walk: sum the list, median of TRIES, in three layouts:
+//    fresh   - built by push_back, so nodes sit in list order
+//    churned - after N random erase + push_back, so list order is scattered
+//    compact - the churned CompactList after compact()
+
+using Clock = std::chrono::steady_clock;
+const int TRIES = 5;
+
+std::size_t requested_bytes = 0;
+
+template <typename T>
+struct CountingAllocator{
+    using value_type = T;
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {}
+    T* allocate(std::size_t n){
+        requested_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept{
+        requested_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+template <typename F>
+double median_ns_per_element(std::size_t n, F fn) {
+    std::vector<double> times;
+    for (int t = 0; t < TRIES; ++t) {
+        auto t0 = Clock::now();
+        fn();
+        auto t1 = Clock::now();
+        times.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / n);
+    }
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+int main() {
+    const std::size_t sizes[] = {1 << 12, 1 << 16, 1 << 20, 1 << 22};
+    std::cout << "Benchmark: list of N ints; walk in ns per element (median of " << TRIES << ")\n\n"
+              << std::setw(9) << "N" << std::setw(22) << "list" << std::setw(8) << "bytes"
+              << std::setw(8) << "fresh" << std::setw(9) << "churned" << std::setw(9) << "compact" << "\n";
+    for (std::size_t n : sizes) {
+        volatile long sink = 0;
+        std::mt19937 rng(5);
+
+        DoublyLinkedList<int, CountingAllocator<int>> d;
+        std::vector<DoublyLinkedList<int, CountingAllocator<int>>::Node*> dh;
+        requested_bytes = 0;
+        for (std::size_t i = 0; i < n; ++i) dh.push_back(d.emplace_back(static_cast<int>(i)));
+        double d_bytes = double(requested_bytes) / n;
+        auto walk_d = [&]{
+            long sum = 0;
+            for (auto* p = d.head(); p; p = p->next) sum += p->data;
+            sink = sink + sum;
+        };
+        double d_fresh = median_ns_per_element(n, walk_d);
+
+        CompactList<int> c;
+        std::vector<CompactList<int>::index_type> ch;
+        for (std::size_t i = 0; i < n; ++i) ch.push_back(c.push_back(static_cast<int>(i)));
+        double c_bytes = double(c.capacity() * sizeof(compact_detail::Node<int>)) / n;
+        auto walk_c = [&]{
+            long sum = 0;
+            for (int x : c) sum += x;
+            sink = sink + sum;
+        };
+        double c_fresh = median_ns_per_element(n, walk_c);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t r = rng() % n;
+            d.erase(dh[r]);
+            dh[r] = d.emplace_back(static_cast<int>(i));
+            c.erase(ch[r]);
+            ch[r] = c.push_back(static_cast<int>(i));
+        }
+        double d_churned = median_ns_per_element(n, walk_d);
+        double c_churned = median_ns_per_element(n, walk_c);
+        c.compact();
+        double c_compact = median_ns_per_element(n, walk_c);
+        double c_packed_bytes = double(c.capacity() * sizeof(compact_detail::Node<int>)) / n;
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(9) << n << std::setw(22) << "DoublyLinkedList<int>" << std::setw(8) << d_bytes
+                  << std::setw(8) << d_fresh << std::setw(9) << d_churned << std::setw(9) << "-" << "\n"
+                  << std::setw(9) << "" << std::setw(22) << "CompactList<int>" << std::setw(8) << c_bytes
+                  << std::setw(8) << c_fresh << std::setw(9) << c_churned << std::setw(9) << c_compact
+                  << "   (" << c_packed_bytes << " bytes after compact)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "../src/concurrent_dynamic_array.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+// 1 to 32 threads append TOTAL uint64_t values in total into one shared
+// array: ConcurrentDynamicArray (fetch_add slots) vs a DynamicArray behind a
+// std::mutex. Reported as million appends per second, median of TRIES.
+
+constexpr std::size_t TOTAL = 4000000;
+constexpr int TRIES = 5;
+
+template <typename Append>
+double median_seconds(std::size_t threads, Append&& make_and_fill) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) t[i] = make_and_fill(threads);
+    std::sort(t, t + TRIES);
+    return t[TRIES / 2];
+}
+
+template <typename Array, typename Push>
+double timed_fill(std::size_t threads, Push push) {
+    Array arr;
+    DynamicArray<std::thread> workers;
+    workers.reserve(threads);
+    const std::size_t per_thread = TOTAL / threads;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&arr, &push, t, per_thread]{
+            for (std::size_t i = 0; i < per_thread; ++i) push(arr, t * per_thread + i);
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+struct Locked {
+    std::mutex m;
+    DynamicArray<std::uint64_t> a;
+};
+
+int main() {
+    std::cout << "Benchmark: " << TOTAL << " concurrent appends (M appends/s, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n\n";
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "concurrent" << std::setw(14) << "mutex" << "\n";
+    for (std::size_t threads = 1; threads <= 32; threads *= 2) {
+        double lock_free = median_seconds(threads, [](std::size_t n){
+            return timed_fill<ConcurrentDynamicArray<std::uint64_t>>(n,
+                [](ConcurrentDynamicArray<std::uint64_t>& a, std::uint64_t v){ a.push_back(v); });
+        });
+        double locked = median_seconds(threads, [](std::size_t n){
+            return timed_fill<Locked>(n, [](Locked& l, std::uint64_t v){
+                std::lock_guard<std::mutex> g(l.m);
+                l.a.push_back(v);
+            });
+        });
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(14) << TOTAL / lock_free / 1e6
+                  << std::setw(14) << TOTAL / locked / 1e6 << "\n";
+    }
+    return 0;
+}
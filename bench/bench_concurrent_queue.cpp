@@ -0,0 +1,101 @@
+#include "../src/concurrent_queue.hpp"
+#include "../src/linked_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+// Producer/consumer pipeline: P producer threads enqueue TOTAL items between
+// them while C consumer threads drain the queue until every item is seen.
+// ConcurrentQueue with try_dequeue, ConcurrentQueue with try_dequeue_bulk
+// (batches of BATCH) and LinkedList<T> behind a std::mutex.
+// Reported as million items per second, median of TRIES.
+
+constexpr std::size_t TOTAL = 2000000;
+constexpr std::size_t BATCH = 32;
+constexpr int TRIES = 3;
+
+struct LockedList {
+    std::mutex m;
+    LinkedList<long> l;
+    void enqueue(long v) {
+        std::lock_guard<std::mutex> g(m);
+        l.push_back(v);
+    }
+    bool try_dequeue(long& out) {
+        std::lock_guard<std::mutex> g(m);
+        if (l.empty()) return false;
+        out = l.head()->data;
+        l.pop_front();
+        return true;
+    }
+};
+
+enum class Mode { single, bulk };
+
+template <typename Q, Mode M>
+double run_once(std::size_t producers, std::size_t consumers) {
+    Q q;
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<long> sum{0};
+    DynamicArray<std::thread> workers;
+    workers.reserve(producers + consumers);
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t p = 0; p < producers; ++p) {
+        std::size_t n = TOTAL / producers + (p < TOTAL % producers ? 1 : 0);
+        workers.emplace_back([&q, n]{
+            for (std::size_t i = 0; i < n; ++i) q.enqueue(static_cast<long>(i));
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+        workers.emplace_back([&]{
+            long local = 0;
+            long batch[BATCH];
+            while (consumed.load(std::memory_order_relaxed) < TOTAL) {
+                std::size_t k = 0;
+                if constexpr (M == Mode::bulk) {
+                    k = q.try_dequeue_bulk(batch, BATCH);
+                } else {
+                    k = q.try_dequeue(batch[0]) ? 1 : 0;
+                }
+                if (k == 0) { std::this_thread::yield(); continue; }
+                for (std::size_t i = 0; i < k; ++i) local += batch[i];
+                consumed.fetch_add(k, std::memory_order_relaxed);
+            }
+            sum.fetch_add(local);
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+template <typename Q, Mode M>
+double mops(std::size_t producers, std::size_t consumers) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) t[i] = run_once<Q, M>(producers, consumers);
+    std::sort(t, t + TRIES);
+    return TOTAL / t[TRIES / 2] / 1e6;
+}
+
+int main() {
+    std::cout << "Benchmark: " << TOTAL << " items through the queue (M items/s, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n\n";
+    std::cout << std::setw(6) << "prod" << std::setw(6) << "cons"
+              << std::setw(18) << "ConcurrentQueue" << std::setw(14) << "bulk x" << BATCH
+              << std::setw(18) << "mutex+LinkedList" << "\n";
+    const std::size_t counts[] = {1, 2, 4, 8};
+    for (std::size_t p : counts) {
+        for (std::size_t c : counts) {
+            std::cout << std::setw(6) << p << std::setw(6) << c << std::fixed << std::setprecision(1)
+                      << std::setw(18) << mops<ConcurrentQueue<long>, Mode::single>(p, c)
+                      << std::setw(16) << mops<ConcurrentQueue<long>, Mode::bulk>(p, c)
+                      << std::setw(18) << mops<LockedList, Mode::single>(p, c) << "\n";
+        }
+    }
+    return 0;
+}
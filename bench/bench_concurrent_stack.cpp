@@ -0,0 +1,74 @@
+#include "../src/concurrent_stack.hpp"
+#include "../src/stack.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+// Shared work pool pattern: 1 to 64 threads each run push/pop pairs on one
+// stack (pre-filled so pops rarely miss). ConcurrentStack vs Stack<T> behind a
+// std::mutex. Reported as million operations per second, median of TRIES.
+
+constexpr std::size_t TOTAL_PAIRS = 2000000;
+constexpr int TRIES = 3;
+
+struct LockedStack {
+    std::mutex m;
+    Stack<long> s;
+    void push(long v) {
+        std::lock_guard<std::mutex> g(m);
+        s.push(v);
+    }
+    bool try_pop(long& out) {
+        std::lock_guard<std::mutex> g(m);
+        if (s.isEmpty()) return false;
+        out = s.top();
+        s.pop();
+        return true;
+    }
+};
+
+template <typename S>
+double run_once(std::size_t threads) {
+    S stack;
+    for (long i = 0; i < 1024; ++i) stack.push(i);
+    const std::size_t per_thread = TOTAL_PAIRS / threads;
+    DynamicArray<std::thread> workers;
+    workers.reserve(threads);
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&stack, per_thread]{
+            long v = 0;
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                stack.push(static_cast<long>(i));
+                stack.try_pop(v);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+template <typename S>
+double mops(std::size_t threads) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) t[i] = run_once<S>(threads);
+    std::sort(t, t + TRIES);
+    return 2.0 * TOTAL_PAIRS / t[TRIES / 2] / 1e6;
+}
+
+int main() {
+    std::cout << "Benchmark: " << TOTAL_PAIRS << " push/pop pairs (M ops/s, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n\n";
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "ConcurrentStack" << std::setw(16) << "mutex+Stack" << "\n";
+    for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(16) << mops<ConcurrentStack<long>>(threads)
+                  << std::setw(16) << mops<LockedStack>(threads) << "\n";
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "../src/dynamic_array.hpp"
+#include "../src/parallel.hpp"
 #include<chrono>
 #include<iostream>
 
@@ -13,12 +14,36 @@ int main(){
 
     volatile long sum = 0;
     auto t2 = std::chrono::high_resolution_clock::now();
-    for(size_t i = 0; i < N; ++i) sum += a[i];
+    for(size_t i = 0; i < N; ++i) sum = sum + a[i];
     auto t3 = std::chrono::high_resolution_clock::now();
     auto ms2 = std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count();
     std::cout<<"read " << N << " ints took " << ms2 << "ms\n";
 
     (void)sum;
+
+    // parallel read/sum scaling over a bandwidth-bound array
+    const size_t M = 64 * 1000 * 1000; //64e6 ints = 256 MB
+    DynamicArray<int> big;
+    big.resize_for_overwrite(M);
+    {
+        ThreadPool pool;
+        parallel::fill(pool, big, 1);
+    }
+    std::cout << "\nparallel::reduce over " << M << " ints ("
+              << ThreadPool::default_threads() << " hardware threads)\n";
+    for(size_t threads = 1; threads <= 2 * ThreadPool::default_threads(); threads *= 2){
+        ThreadPool pool(threads);
+        long total = 0;
+        auto t4 = std::chrono::high_resolution_clock::now();
+        for(int rep = 0; rep < 5; ++rep){
+            total += parallel::reduce(pool, big, 0L, [](long x, long v){ return x + v; });
+        }
+        auto t5 = std::chrono::high_resolution_clock::now();
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(t5 - t4).count() / 5;
+        double gbs = double(M * sizeof(int)) / (us * 1e3);
+        std::cout << "  threads=" << threads << " sum took " << us << "us (" << gbs << " GB/s)"
+                  << (total == 5L * (long)M ? "" : "  WRONG SUM") << "\n";
+    }
     return 0;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,49 @@
+#include "../src/dynamic_array.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+// Queue-like workload: fill an array, drain it back to empty, repeat.
+// Reports wall time and allocation count for each growth/shrink policy.
+
+static long allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(std::size_t n) { ++allocations; return std::allocator<T>().allocate(n); }
+    void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+};
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+template <typename Policy>
+void run(const char* name, long fill, int cycles) {
+    DynamicArray<long, CountingAllocator<long>, Policy> a;
+    allocations = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int c = 0; c < cycles; ++c) {
+        for (long i = 0; i < fill; ++i) a.push_back(i);
+        while (!a.empty()) a.pop_back();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    long us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+    std::cout << name << ": " << us << " us, " << allocations << " allocations\n";
+}
+
+int main() {
+    const long FILL = 100000;   // elements per cycle
+    const int CYCLES = 200;     // fill/drain cycles
+
+    std::cout << "Benchmark: FILL=" << FILL << " CYCLES=" << CYCLES << "\n\n";
+    run<DefaultGrowthPolicy>("2x, auto-shrink   (DefaultGrowthPolicy) ", FILL, CYCLES);
+    run<CompactGrowthPolicy>("1.5x, auto-shrink (CompactGrowthPolicy) ", FILL, CYCLES);
+    run<GrowthPolicy<2, 1, 8, true>>("2x, shrink at 1/8 (GrowthPolicy<2,1,8>) ", FILL, CYCLES);
+    run<RetainCapacityPolicy>("2x, no shrink     (RetainCapacityPolicy)", FILL, CYCLES);
+    return 0;
+}
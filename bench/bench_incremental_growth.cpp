@@ -0,0 +1,54 @@
+#include "../src/incremental_dynamic_array.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+// push_back latency distribution: DynamicArray (full copy on growth) vs
+// IncrementalDynamicArray (growth spread over later pushes). Every push is
+// timed on its own; the timer itself costs a few tens of ns.
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Array, typename Make>
+void run(const char* name, std::size_t n, Make make) {
+    DynamicArray<std::uint32_t> ns;
+    ns.resize_for_overwrite(n);
+    Array a;
+    for (std::size_t i = 0; i < n; ++i) {
+        auto value = make(i);
+        auto t0 = Clock::now();
+        a.push_back(std::move(value));
+        auto t1 = Clock::now();
+        ns[i] = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    }
+    std::sort(ns.begin(), ns.end());
+    auto pct = [&](double p){ return ns[static_cast<std::size_t>(p * (n - 1))]; };
+    std::cout << "  " << std::left << std::setw(26) << name << std::right
+              << std::setw(9) << pct(0.5) << std::setw(9) << pct(0.99) << std::setw(9) << pct(0.999)
+              << std::setw(10) << pct(0.9999) << std::setw(12) << ns[n - 1] << "\n";
+}
+
+static void header(const char* what, std::size_t n) {
+    std::cout << what << ", " << n << " pushes (ns)\n"
+              << "  " << std::left << std::setw(26) << "" << std::right
+              << std::setw(9) << "p50" << std::setw(9) << "p99" << std::setw(9) << "p99.9"
+              << std::setw(10) << "p99.99" << std::setw(12) << "max" << "\n";
+}
+
+int main() {
+    const std::size_t n = 16 * 1000 * 1000;
+    header("uint64_t", n);
+    run<DynamicArray<std::uint64_t>>("DynamicArray", n, [](std::size_t i){ return std::uint64_t(i); });
+    run<IncrementalDynamicArray<std::uint64_t>>("IncrementalDynamicArray", n, [](std::size_t i){ return std::uint64_t(i); });
+
+    const std::size_t m = 2 * 1000 * 1000;
+    std::cout << "\n";
+    header("std::string (32 chars)", m);
+    run<DynamicArray<std::string>>("DynamicArray", m, [](std::size_t i){ return std::string(32, char('a' + i % 26)); });
+    run<IncrementalDynamicArray<std::string>>("IncrementalDynamicArray", m, [](std::size_t i){ return std::string(32, char('a' + i % 26)); });
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "../src/dynamic_array.hpp"
+#include "../src/mmap_allocator.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// Read a large file into DynamicArray<char> four ways:
+//   resize + read            (zeroes every byte first)
+//   push_back per byte       (from a 64 KB stack buffer)
+//   resize_for_overwrite     (no zeroing, one read loop)
+//   spare_capacity + commit  (no zeroing, no size known up front), with
+//                            std::allocator, after reserve(size), and with
+//                            LargeBufferAllocator (growth by mremap)
+//
+//   ./bench_ingest [file]    (default: writes a 256 MB temp file)
+
+const std::size_t CHUNK = 64 * 1024;
+
+template <typename F>
+long run_once(F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+std::size_t file_size(const char* path) {
+    struct stat st;
+    if (stat(path, &st) != 0) return 0;
+    return static_cast<std::size_t>(st.st_size);
+}
+
+// reads exactly n bytes into p (or until EOF)
+std::size_t read_all(int fd, char* p, std::size_t n) {
+    std::size_t got = 0;
+    while (got < n) {
+        ssize_t r = ::read(fd, p + got, n - got);
+        if (r <= 0) break;
+        got += static_cast<std::size_t>(r);
+    }
+    return got;
+}
+
+int main(int argc, char** argv) {
+    std::string path = argc > 1 ? argv[1] : "/tmp/ds_bench_ingest.bin";
+    if (argc <= 1) {
+        const std::size_t size = std::size_t(256) * 1024 * 1024;
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) { std::cerr << "cannot create " << path << "\n"; return 1; }
+        std::vector<char> block(CHUNK);
+        for (std::size_t i = 0; i < CHUNK; ++i) block[i] = static_cast<char>(i * 31);
+        for (std::size_t w = 0; w < size; w += CHUNK) std::fwrite(block.data(), 1, CHUNK, f);
+        std::fclose(f);
+    }
+    const std::size_t size = file_size(path.c_str());
+    std::cout << "Benchmark: read " << size / (1024 * 1024) << " MB from " << path << " (page cache warm after first pass)\n\n";
+
+    volatile char sink = 0;
+
+    long resize_us = run_once([&]() {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        DynamicArray<char> buf;
+        buf.resize(size);
+        read_all(fd, buf.data(), size);
+        ::close(fd);
+        sink = buf[size / 2];
+    });
+
+    long push_us = run_once([&]() {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        DynamicArray<char> buf;
+        char chunk[CHUNK];
+        ssize_t r;
+        while ((r = ::read(fd, chunk, CHUNK)) > 0)
+            for (ssize_t i = 0; i < r; ++i) buf.push_back(chunk[i]);
+        ::close(fd);
+        sink = buf[size / 2];
+    });
+
+    long overwrite_us = run_once([&]() {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        DynamicArray<char> buf;
+        buf.resize_for_overwrite(size);
+        read_all(fd, buf.data(), size);
+        ::close(fd);
+        sink = buf[size / 2];
+    });
+
+    auto spare_read = [&](auto& buf) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        for (;;) {
+            char* p = buf.spare_capacity(1);   // grows by the policy only when full
+            ssize_t r = ::read(fd, p, buf.spare_size());
+            if (r <= 0) break;
+            buf.commit_append(static_cast<std::size_t>(r));
+        }
+        ::close(fd);
+        sink = buf[size / 2];
+    };
+
+    long spare_us = run_once([&]() {
+        DynamicArray<char> buf;
+        spare_read(buf);
+    });
+
+    long spare_reserved_us = run_once([&]() {
+        DynamicArray<char> buf;
+        buf.reserve(size + 1);   // +1: the final read() that sees EOF still asks for room
+        spare_read(buf);
+    });
+
+    long spare_mremap_us = run_once([&]() {
+        DynamicArray<char, LargeBufferAllocator<char>> buf;
+        spare_read(buf);
+    });
+
+    std::cout << "resize + read               us: " << resize_us << "\n"
+              << "push_back per byte          us: " << push_us << "\n"
+              << "resize_for_overwrite + read us: " << overwrite_us << "\n"
+              << "spare_capacity + commit     us: " << spare_us << "\n"
+              << "  ... after reserve(size)   us: " << spare_reserved_us << "\n"
+              << "  ... LargeBufferAllocator  us: " << spare_mremap_us << "\n";
+
+    if (argc <= 1) std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "../src/intrusive_list.hpp"
+#include "../src/doubly_linked_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+// Timer-wheel shape: OBJECTS timers owned by an array; a list tracks the armed
+// ones. IntrusiveList<Timer> links the timers themselves; DoublyLinkedList<Timer*>
+// allocates a node per membership and reaches the timer through a pointer.
+//  - fifo: read and pop_front the oldest timer, push_back the next one
+//    (STEPS times), with timers armed in address order and in random order
+//  - unlink: pick a random timer, disarm it if armed, else arm it. The
+//    intrusive list unlinks in O(1); DoublyLinkedList can only erase by index,
+//    so the timer's position has to be searched for first (fewer steps)
+//  - walk: sum the deadlines of the armed timers after the fifo churn
+
+using Clock = std::chrono::steady_clock;
+const int TRIES = 5;
+
+struct Timer : IntrusiveListHook<> {
+    std::uint64_t deadline;
+    char payload[48];
+    bool armed = false;
+    explicit Timer(std::uint64_t d) : deadline(d), payload{} {}
+};
+
+template <typename F>
+long median_us(F fn) {
+    std::vector<long> times;
+    for (int t = 0; t < TRIES; ++t) {
+        auto t0 = Clock::now();
+        fn();
+        auto t1 = Clock::now();
+        times.push_back(static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()));
+    }
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+struct Row { long fifo, walk; };
+
+Row intrusive_fifo(DynamicArray<Timer>& timers, const std::vector<std::uint32_t>& order,
+                   std::size_t armed, long steps) {
+    volatile std::uint64_t sink = 0;
+    IntrusiveList<Timer> l;
+    for (std::size_t i = 0; i < armed; ++i) l.push_back(timers[order[i]]);
+    std::size_t next = armed;
+    Row r;
+    r.fifo = median_us([&]{
+        std::uint64_t fired = 0;
+        for (long s = 0; s < steps; ++s) {
+            fired += l.front().deadline;                      // fire the oldest
+            l.pop_front();
+            l.push_back(timers[order[next]]);
+            next = next + 1 == order.size() ? 0 : next + 1;
+        }
+        sink = sink + fired;
+    });
+    r.walk = median_us([&]{
+        std::uint64_t sum = 0;
+        for (const Timer& t : l) sum += t.deadline;
+        sink = sink + sum;
+    });
+    l.clear();
+    return r;
+}
+
+Row list_fifo(DynamicArray<Timer>& timers, const std::vector<std::uint32_t>& order,
+              std::size_t armed, long steps) {
+    volatile std::uint64_t sink = 0;
+    DoublyLinkedList<Timer*> l;
+    for (std::size_t i = 0; i < armed; ++i) l.push_back(&timers[order[i]]);
+    std::size_t next = armed;
+    Row r;
+    r.fifo = median_us([&]{
+        std::uint64_t fired = 0;
+        for (long s = 0; s < steps; ++s) {
+            fired += l.head()->data->deadline;
+            l.pop_front();
+            l.push_back(&timers[order[next]]);
+            next = next + 1 == order.size() ? 0 : next + 1;
+        }
+        sink = sink + fired;
+    });
+    r.walk = median_us([&]{
+        std::uint64_t sum = 0;
+        for (auto* n = l.head(); n; n = n->next) sum += n->data->deadline;
+        sink = sink + sum;
+    });
+    return r;
+}
+
+static void print(const char* name, Row r, long unlink) {
+    std::cout << "  " << std::left << std::setw(28) << name << std::right
+              << std::setw(12) << r.fifo << std::setw(12) << r.walk << std::setw(12) << unlink << "\n";
+}
+
+int main() {
+    const std::size_t OBJECTS = 1 << 18;
+    const std::size_t ARMED = 1 << 16;          // fifo depth
+    const long STEPS = 10000000;
+    const long UNLINK_STEPS = 20000;
+    const std::size_t UNLINK_OBJECTS = 4096;
+
+    DynamicArray<Timer> timers;
+    timers.reserve(OBJECTS);
+    for (std::size_t i = 0; i < OBJECTS; ++i) timers.emplace_back(i);
+    std::vector<std::uint32_t> sequential(OBJECTS);
+    for (std::size_t i = 0; i < OBJECTS; ++i) sequential[i] = static_cast<std::uint32_t>(i);
+    std::vector<std::uint32_t> shuffled = sequential;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(3));
+
+    Row seq_i = intrusive_fifo(timers, sequential, ARMED, STEPS);
+    Row seq_d = list_fifo(timers, sequential, ARMED, STEPS);
+    Row shuf_i = intrusive_fifo(timers, shuffled, ARMED, STEPS);
+    Row shuf_d = list_fifo(timers, shuffled, ARMED, STEPS);
+
+    long unlink_i = 0, unlink_d = 0;
+    {
+        IntrusiveList<Timer> l;
+        std::mt19937 rng(9);
+        unlink_i = median_us([&]{
+            for (long s = 0; s < UNLINK_STEPS; ++s) {
+                Timer& t = timers[rng() % UNLINK_OBJECTS];
+                if (t.is_linked()) l.erase(t);
+                else l.push_back(t);
+            }
+        });
+        l.clear();
+    }
+    {
+        DoublyLinkedList<Timer*> l;
+        std::mt19937 rng(9);
+        unlink_d = median_us([&]{
+            for (long s = 0; s < UNLINK_STEPS; ++s) {
+                Timer& t = timers[rng() % UNLINK_OBJECTS];
+                if (t.armed) {
+                    std::size_t index = 0;
+                    for (auto* n = l.head(); n->data != &t; n = n->next) ++index;
+                    l.erase_at(index);
+                } else {
+                    l.push_back(&t);
+                }
+                t.armed = !t.armed;
+            }
+        });
+    }
+
+    std::cout << "Benchmark: " << OBJECTS << " timers, fifo of " << ARMED << " x " << STEPS
+              << " steps, unlink " << UNLINK_STEPS << " steps over " << UNLINK_OBJECTS
+              << " timers; TRIES=" << TRIES << " (median, us)\n\n"
+              << "  " << std::left << std::setw(28) << "" << std::right
+              << std::setw(12) << "fifo" << std::setw(12) << "walk" << std::setw(12) << "unlink" << "\n";
+    std::cout << " timers armed in address order\n";
+    print("IntrusiveList<Timer>", seq_i, unlink_i);
+    print("DoublyLinkedList<Timer*>", seq_d, unlink_d);
+    std::cout << " timers armed in random order\n";
+    print("IntrusiveList<Timer>", shuf_i, unlink_i);
+    print("DoublyLinkedList<Timer*>", shuf_d, unlink_d);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "../src/linked_list.hpp"
+#include "../src/doubly_linked_list.hpp"
+#include "../src/allocators.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Message-queue shape: QUEUES lists of about DEPTH messages each; every step
+// pushes a message onto one queue and pops one from another. Meanwhile other
+// heap traffic (variable-sized buffers kept for a while) interleaves with the
+// node allocations, as it does in a real process. After the churn, each
+// queue is traversed once.
+//
+// new/delete (std::allocator) vs. a private NodePoolAllocator per list vs.
+// one NodePoolAllocator shared by all lists.
+
+using Clock = std::chrono::steady_clock;
+
+struct Msg {
+    std::uint64_t id;
+    std::uint64_t payload[3];
+    Msg(std::uint64_t i) : id(i), payload{i, i, i} {}
+};
+
+const int QUEUES = 64;
+const int DEPTH = 2000;
+const long STEPS = 4000000;
+const int TRIES = 5;
+
+struct Result { long churn_us; long walk_us; };
+
+template <typename List, typename MakeList>
+Result run_once(MakeList make_list) {
+    std::vector<std::unique_ptr<List>> queues;
+    for (int q = 0; q < QUEUES; ++q) {
+        queues.push_back(make_list());
+        for (int i = 0; i < DEPTH; ++i) queues.back()->push_back(Msg(i));
+    }
+    std::mt19937 rng(7);
+    std::vector<std::unique_ptr<char[]>> noise(1024);
+    volatile std::uint64_t sink = 0;
+
+    auto t0 = Clock::now();
+    for (long s = 0; s < STEPS; ++s) {
+        std::uint32_t r = rng();
+        List& in = *queues[r % QUEUES];
+        List& out = *queues[(r >> 8) % QUEUES];
+        in.push_back(Msg(static_cast<std::uint64_t>(s)));
+        if (!out.empty()) {
+            sink = sink + out.head()->data.id;
+            out.pop_front();
+        }
+        if ((s & 7) == 0) noise[(r >> 16) % noise.size()].reset(new char[16 + (r >> 26) * 8]);
+    }
+    auto t1 = Clock::now();
+    std::uint64_t sum = 0;
+    for (auto& q : queues) {
+        for (auto* n = q->head(); n; n = n->next) sum += n->data.payload[1];
+    }
+    auto t2 = Clock::now();
+    sink = sink + sum;
+    return {static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()),
+            static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count())};
+}
+
+template <typename List, typename MakeList>
+void run(const char* name, MakeList make_list) {
+    std::vector<long> churn, walk;
+    for (int t = 0; t < TRIES; ++t) {
+        Result r = run_once<List>(make_list);
+        churn.push_back(r.churn_us);
+        walk.push_back(r.walk_us);
+    }
+    std::sort(churn.begin(), churn.end());
+    std::sort(walk.begin(), walk.end());
+    std::cout << "  " << std::left << std::setw(34) << name << std::right
+              << std::setw(12) << churn[TRIES / 2] << std::setw(12) << walk[TRIES / 2] << "\n";
+}
+
+template <template <typename, typename> class ListT>
+void suite(const char* what) {
+    using Plain = ListT<Msg, std::allocator<Msg>>;
+    using Pooled = ListT<Msg, NodePoolAllocator<Msg>>;
+    std::cout << what << "\n  " << std::left << std::setw(34) << "" << std::right
+              << std::setw(12) << "churn us" << std::setw(12) << "walk us" << "\n";
+    run<Plain>("new/delete", []{ return std::make_unique<Plain>(); });
+    run<Pooled>("NodePoolAllocator (per list)", []{ return std::make_unique<Pooled>(); });
+    NodePoolAllocator<Msg> shared(1024);
+    run<Pooled>("NodePoolAllocator (shared)", [&]{ return std::make_unique<Pooled>(shared); });
+}
+
+int main() {
+    std::cout << "Benchmark: " << QUEUES << " queues x " << DEPTH << " messages, " << STEPS
+              << " push/pop steps, TRIES=" << TRIES << " (median)\n\n";
+    suite<LinkedList>("LinkedList<Msg>");
+    std::cout << "\n";
+    suite<DoublyLinkedList>("DoublyLinkedList<Msg>");
+    return 0;
+}
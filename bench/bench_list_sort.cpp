@@ -0,0 +1,79 @@
+#include "../src/linked_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+// Sorting a LinkedList<uint64_t> of random keys:
+//  - relink: LinkedList::sort(), bottom-up merge sort over the nodes
+//  - rebuild: copy into a DynamicArray, std::sort, clear the list and
+//    push_back everything again (n frees and n allocations)
+// "walk" sums the sorted list afterwards: relinked nodes are visited in key
+// order, i.e. in random address order, while rebuilt ones are sequential.
+// Usage: bench_list_sort [millions of nodes, default 10]
+
+using Clock = std::chrono::steady_clock;
+
+static long ms_since(Clock::time_point t0) {
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - t0).count());
+}
+
+static void fill(LinkedList<std::uint64_t>& l, std::size_t n) {
+    std::mt19937_64 rng(42);
+    l.clear();
+    for (std::size_t i = 0; i < n; ++i) l.push_back(rng());
+}
+
+static std::uint64_t walk(const LinkedList<std::uint64_t>& l) {
+    std::uint64_t s = 0;
+    for (std::uint64_t v : l) s += v;
+    return s;
+}
+
+static bool sorted(const LinkedList<std::uint64_t>& l) {
+    return std::is_sorted(l.begin(), l.end());
+}
+
+int main(int argc, char** argv) {
+    std::size_t millions = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10;
+    std::size_t n = millions * 1000 * 1000;
+    std::cout << "Benchmark: sort LinkedList<uint64_t> of " << n << " random keys (ms)\n\n"
+              << "  " << std::left << std::setw(10) << "" << std::right
+              << std::setw(10) << "sort" << std::setw(10) << "walk" << "\n";
+    volatile std::uint64_t sink = 0;
+    LinkedList<std::uint64_t> l;
+
+    fill(l, n);
+    auto t0 = Clock::now();
+    l.sort();
+    long sort_ms = ms_since(t0);
+    t0 = Clock::now();
+    sink = sink + walk(l);
+    long walk_ms = ms_since(t0);
+    if (!sorted(l)) std::cout << "  relink: NOT SORTED\n";
+    std::cout << "  " << std::left << std::setw(10) << "relink" << std::right
+              << std::setw(10) << sort_ms << std::setw(10) << walk_ms << "\n";
+
+    fill(l, n);
+    t0 = Clock::now();
+    {
+        DynamicArray<std::uint64_t> a;
+        a.reserve(l.size());
+        for (std::uint64_t v : l) a.push_back(v);
+        std::sort(a.begin(), a.end());
+        l.clear();
+        for (std::uint64_t v : a) l.push_back(v);
+    }
+    sort_ms = ms_since(t0);
+    t0 = Clock::now();
+    sink = sink + walk(l);
+    walk_ms = ms_since(t0);
+    if (!sorted(l)) std::cout << "  rebuild: NOT SORTED\n";
+    std::cout << "  " << std::left << std::setw(10) << "rebuild" << std::right
+              << std::setw(10) << sort_ms << std::setw(10) << walk_ms << "\n";
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "../src/lru_cache.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <list>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Cache-aside workload: OPS lookups of Zipf(s)-distributed keys drawn from
+// UNIVERSE keys; a miss puts the key. LRUCache against the textbook
+// std::list + std::unordered_map LRU (one new per entry in each).
+// Reported as million ops per second (median of TRIES) and hit rate.
+
+using Clock = std::chrono::steady_clock;
+constexpr std::uint32_t UNIVERSE = 1 << 20;
+constexpr std::size_t OPS = 4000000;
+constexpr int TRIES = 3;
+
+// keys are ranks shuffled over the universe, so hot keys are not neighbours
+DynamicArray<std::uint32_t> zipf_trace(double s, std::size_t n, std::uint32_t seed){
+    std::vector<double> cdf(UNIVERSE);
+    double sum = 0;
+    for(std::uint32_t i = 0; i < UNIVERSE; ++i){
+        sum += 1.0 / std::pow(i + 1.0, s);
+        cdf[i] = sum;
+    }
+    std::vector<std::uint32_t> key(UNIVERSE);
+    for(std::uint32_t i = 0; i < UNIVERSE; ++i) key[i] = i;
+    std::mt19937 rng(seed);
+    std::shuffle(key.begin(), key.end(), rng);
+    std::uniform_real_distribution<double> u(0, sum);
+    DynamicArray<std::uint32_t> trace;
+    trace.reserve(n);
+    for(std::size_t i = 0; i < n; ++i){
+        auto rank = std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin();
+        trace.push_back(key[std::min<std::size_t>(rank, UNIVERSE - 1)]);
+    }
+    return trace;
+}
+
+struct Payload{ std::uint64_t a, b; };
+
+struct StdLRU{
+    std::size_t cap;
+    std::list<std::pair<std::uint32_t, Payload>> order;
+    std::unordered_map<std::uint32_t, decltype(order)::iterator> index;
+
+    explicit StdLRU(std::size_t c) : cap(c) {}
+    Payload* get(std::uint32_t k){
+        auto it = index.find(k);
+        if(it == index.end()) return nullptr;
+        order.splice(order.begin(), order, it->second);
+        return &it->second->second;
+    }
+    void put(std::uint32_t k, Payload v){
+        order.emplace_front(k, v);
+        index.emplace(k, order.begin());
+        if(order.size() > cap){
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+    }
+};
+
+struct Result{ double mops, hit_rate; };
+
+template <typename Make>
+Result run(const DynamicArray<std::uint32_t>& trace, Make make){
+    double t[TRIES];
+    double hit_rate = 0;
+    volatile std::uint64_t sink = 0;
+    for(int r = 0; r < TRIES; ++r){
+        auto cache = make();
+        std::size_t hits = 0;
+        std::uint64_t sum = 0;
+        auto t0 = Clock::now();
+        for(std::uint32_t k : trace){
+            if(Payload* p = cache->get(k)){ sum += p->a; ++hits; }
+            else cache->put(k, Payload{k, 0});
+        }
+        auto t1 = Clock::now();
+        sink = sink + sum;
+        t[r] = std::chrono::duration<double>(t1 - t0).count();
+        hit_rate = double(hits) / trace.size();
+    }
+    std::sort(t, t + TRIES);
+    return {trace.size() / t[TRIES / 2] / 1e6, hit_rate};
+}
+
+int main(){
+    std::cout << "Benchmark: " << OPS << " get-or-put ops, Zipf keys over " << UNIVERSE
+              << " keys; TRIES=" << TRIES << " (M ops/s, median)\n\n";
+    std::cout << std::setw(6) << "s" << std::setw(10) << "capacity" << std::setw(10) << "hit rate"
+              << std::setw(12) << "LRUCache" << std::setw(20) << "std::list+map" << "\n";
+    const double skews[] = {0.8, 0.99, 1.2};
+    const std::size_t capacities[] = {UNIVERSE / 100, UNIVERSE / 10};
+    for(double s : skews){
+        DynamicArray<std::uint32_t> trace = zipf_trace(s, OPS, 42);
+        for(std::size_t cap : capacities){
+            Result a = run(trace, [cap]{ return std::make_unique<LRUCache<std::uint32_t, Payload>>(cap); });
+            Result b = run(trace, [cap]{ return std::make_unique<StdLRU>(cap); });
+            assert(a.hit_rate == b.hit_rate);
+            std::cout << std::fixed << std::setprecision(2) << std::setw(6) << s
+                      << std::setw(10) << cap << std::setprecision(3) << std::setw(10) << a.hit_rate
+                      << std::setprecision(1) << std::setw(12) << a.mops << std::setw(20) << b.mops << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "../src/dynamic_array.hpp"
+#include "../src/mmap_allocator.hpp"
+#include <chrono>
+#include <iostream>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Grow a DynamicArray<uint64_t> by push_back until it holds TARGET bytes and
+// report wall time and peak RSS. Each mode runs in its own child process so
+// the peak RSS numbers do not leak into each other.
+//
+//   ./bench_mmap_growth [target_MB]      (default 4096 = 4 GB)
+
+template <typename Array>
+void grow(std::size_t target_bytes) {
+    const std::size_t n = target_bytes / sizeof(std::uint64_t);
+    auto t0 = std::chrono::steady_clock::now();
+    Array a;
+    for (std::size_t i = 0; i < n; ++i) a.push_back(i);
+    auto t1 = std::chrono::steady_clock::now();
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+    long peak_mb = ru.ru_maxrss / (1024 * 1024);
+#else
+    long peak_mb = ru.ru_maxrss / 1024;
+#endif
+    std::cout << "  " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+              << " ms, peak RSS " << peak_mb << " MB (data " << target_bytes / (1024 * 1024) << " MB)"
+              << ", last=" << a[n - 1] << "\n" << std::flush;
+}
+
+template <typename Array>
+void run(const char* name, std::size_t target_bytes) {
+    std::cout << name << "\n" << std::flush;
+    pid_t pid = fork();
+    if (pid == 0) {
+        grow<Array>(target_bytes);
+        std::_Exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) std::cout << "  failed (out of memory?)\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t target_mb = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    std::size_t target = target_mb * 1024 * 1024;
+    std::cout << "Benchmark: grow DynamicArray<uint64_t> to " << target_mb << " MB\n\n";
+
+    run<DynamicArray<std::uint64_t>>("std::allocator (allocate + memcpy + free)", target);
+    run<DynamicArray<std::uint64_t, LargeBufferAllocator<std::uint64_t>>>("LargeBufferAllocator (mremap)", target);
+    run<DynamicArray<std::uint64_t, LargeBufferAllocator<std::uint64_t, (std::size_t(1) << 26), true>>>(
+        "LargeBufferAllocator (mremap + THP)", target);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "../src/dynamic_array.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+// Range mutators vs. the equivalent element-wise loops.
+
+template <typename F>
+long run_once(F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+DynamicArray<int> make(long n) {
+    DynamicArray<int> a;
+    a.reserve(n);
+    for (long i = 0; i < n; ++i) a.push_back((int)i);
+    return a;
+}
+
+int main() {
+    const long N = 1000000;   // array size
+    const long K = 2000;      // elements inserted/removed
+
+    std::cout << "Benchmark: N=" << N << " K=" << K << "\n\n";
+
+    std::vector<int> block(K);
+    for (long i = 0; i < K; ++i) block[i] = (int)-i;
+
+    // insert K elements in the middle
+    {
+        DynamicArray<int> a = make(N);
+        long loop_us = run_once([&]() {
+            for (long i = 0; i < K; ++i) a.insert(N / 2 + i, block[i]);
+        });
+        DynamicArray<int> b = make(N);
+        long range_us = run_once([&]() { b.insert(N / 2, block.begin(), block.end()); });
+        std::cout << "insert K mid:      element-wise us: " << loop_us << "   insert(index, first, last) us: " << range_us << "\n";
+    }
+
+    // remove K contiguous elements from the middle
+    {
+        DynamicArray<int> a = make(N);
+        long loop_us = run_once([&]() {
+            for (long i = 0; i < K; ++i) a.erase(N / 2);
+        });
+        DynamicArray<int> b = make(N);
+        long range_us = run_once([&]() { b.erase(b.begin() + N / 2, b.begin() + N / 2 + K); });
+        std::cout << "erase K mid:       element-wise us: " << loop_us << "   erase(first, last) us: " << range_us << "\n";
+    }
+
+    // remove K scattered elements (every N/K-th)
+    {
+        const long stride = N / K;
+        DynamicArray<int> a = make(N);
+        long loop_us = run_once([&]() {
+            for (long i = (long)a.size() - 1; i >= 0; --i)
+                if (a[i] % stride == 0) a.erase(i);
+        });
+        DynamicArray<int> b = make(N);
+        long range_us = run_once([&]() { b.erase_if([&](int v) { return v % stride == 0; }); });
+        std::cout << "erase K scattered: element-wise us: " << loop_us << "   erase_if us: " << range_us << "\n";
+    }
+
+    // drop 90% of the elements (element-wise erase also shrinks repeatedly)
+    {
+        DynamicArray<int> a = make(N / 10);
+        long loop_us = run_once([&]() {
+            for (long i = (long)a.size() - 1; i >= 0; --i)
+                if (a[i] % 10 != 0) a.erase(i);
+        });
+        DynamicArray<int> b = make(N / 10);
+        long range_us = run_once([&]() { b.erase_if([](int v) { return v % 10 != 0; }); });
+        std::cout << "erase 90% of N/10: element-wise us: " << loop_us << "   erase_if us: " << range_us << "\n";
+    }
+
+    // build an N-element array from K-element blocks
+    {
+        long loop_us = run_once([&]() {
+            DynamicArray<int> a;
+            for (long n = 0; n < N; n += K)
+                for (long i = 0; i < K; ++i) a.push_back(block[i]);
+        });
+        long range_us = run_once([&]() {
+            DynamicArray<int> b;
+            for (long n = 0; n < N; n += K) b.append(block.begin(), block.end());
+        });
+        std::cout << "append N in K-blocks: element-wise us: " << loop_us << "   append(first, last) us: " << range_us << "\n";
+    }
+    return 0;
+}
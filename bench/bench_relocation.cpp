@@ -0,0 +1,119 @@
+#include "../src/dynamic_array.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+// Each element type comes in two flavours with identical layout:
+// one that takes the memcpy/memmove relocation path and one that is forced
+// onto the per-element construct/destroy path.
+
+// int: trivially copyable vs. a wrapper with a user-provided copy ctor
+struct SlowInt {
+    int v;
+    SlowInt(int x = 0): v(x) {}
+    SlowInt(const SlowInt& o): v(o.v) {}
+    SlowInt& operator=(const SlowInt& o) { v = o.v; return *this; }
+};
+
+// 64-byte POD vs. the same bytes behind a user-provided copy ctor
+struct Pod64 {
+    long words[8];
+    Pod64(int x = 0) { for (auto& w : words) w = x; }
+};
+
+struct SlowPod64 {
+    long words[8];
+    SlowPod64(int x = 0) { for (auto& w : words) w = x; }
+    SlowPod64(const SlowPod64& o) { std::copy(o.words, o.words + 8, words); }
+    SlowPod64& operator=(const SlowPod64& o) { std::copy(o.words, o.words + 8, words); return *this; }
+};
+
+// Non-trivial type that counts operations (same as bench_emplace_vs_push)
+struct Heavy {
+    static long constructions, destructions, copies, moves;
+    std::unique_ptr<int> payload;
+    Heavy(int v=0): payload(new int(v)) { ++constructions; }
+    Heavy(const Heavy& o): payload(new int(*o.payload)) { ++constructions; ++copies; }
+    Heavy(Heavy&& o) noexcept: payload(std::move(o.payload)) { ++constructions; ++moves; }
+    ~Heavy() { ++destructions; }
+};
+long Heavy::constructions = 0;
+long Heavy::destructions = 0;
+long Heavy::copies = 0;
+long Heavy::moves = 0;
+
+// Heavy with the opt-in: a unique_ptr owner does not point into itself
+struct RelocatableHeavy : Heavy {
+    using Heavy::Heavy;
+};
+template <> struct is_trivially_relocatable<RelocatableHeavy> : std::true_type {};
+
+template <typename F>
+long run_once(F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+const int TRIES = 5;
+
+template <typename F>
+long median_time(F fn) {
+    std::vector<long> times;
+    for (int t = 0; t < TRIES; ++t) times.push_back(run_once(fn));
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+// grow from empty (every doubling relocates) and drain (every shrink relocates)
+template <typename T>
+long bench_grow_shrink(long n) {
+    return median_time([&]() {
+        DynamicArray<T> a;
+        for (long i = 0; i < n; ++i) a.emplace_back((int)i);
+        while (!a.empty()) a.pop_back();
+    });
+}
+
+// insert/erase in the middle of an array of n elements, k times each
+template <typename T>
+long bench_mid_edit(long n, long k) {
+    DynamicArray<T> a;
+    a.reserve(n + 1);
+    for (long i = 0; i < n; ++i) a.emplace_back((int)i);
+    return median_time([&]() {
+        for (long i = 0; i < k; ++i) {
+            a.insert(a.size() / 2, T((int)i));
+            a.erase(a.size() / 2);
+        }
+    });
+}
+
+template <typename Fast, typename Slow>
+void report(const char* name, long n, long mid_n, long k) {
+    long fast_grow = bench_grow_shrink<Fast>(n);
+    long slow_grow = bench_grow_shrink<Slow>(n);
+    long fast_mid = bench_mid_edit<Fast>(mid_n, k);
+    long slow_mid = bench_mid_edit<Slow>(mid_n, k);
+    std::cout << name << "\n"
+              << "  grow+drain  relocatable us: " << fast_grow << "   per-element us: " << slow_grow << "\n"
+              << "  mid edits   relocatable us: " << fast_mid  << "   per-element us: " << slow_mid  << "\n";
+}
+
+int main() {
+    const long N = 2000000;       // elements pushed then popped
+    const long MID_N = 100000;    // array size for mid-array edits
+    const long K = 1000;          // insert+erase pairs
+
+    std::cout << "Benchmark: N=" << N << " MID_N=" << MID_N << " K=" << K
+              << " TRIES=" << TRIES << " (median)\n\n";
+
+    report<int, SlowInt>("int", N, MID_N, K);
+    report<Pod64, SlowPod64>("Pod64 (64 bytes)", N, MID_N, K);
+
+    report<RelocatableHeavy, Heavy>("Heavy (unique_ptr payload)", N / 4, MID_N / 4, K);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "../src/segmented_array.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+// SegmentedArray vs DynamicArray on N uint64_t:
+//   append      total time and the slowest single push_back (relocation spike)
+//   scan        sum via operator[], via iterators, via for_each_block / data()
+//   random      sum at N pseudo-random indices
+
+constexpr std::size_t N = 32 * 1000 * 1000;
+using Clock = std::chrono::steady_clock;
+
+volatile std::uint64_t sink;
+
+static double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+template <typename Array>
+void append(const char* name) {
+    double total;
+    {
+        Array a;
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < N; ++i) a.push_back(i);
+        total = ms_since(t0);
+        sink = a[N - 1];
+    }
+    // second pass times every push on its own to find the worst stall
+    Array a;
+    double worst_us = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        auto s = Clock::now();
+        a.push_back(i);
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - s).count();
+        if (us > worst_us) worst_us = us;
+    }
+    std::cout << "  " << name << ": " << total << " ms, slowest single push_back " << worst_us / 1000.0 << " ms\n";
+}
+
+template <typename Array, typename Block>
+void scan(const char* name, const Array& a, Block&& block_sum) {
+    auto t0 = Clock::now();
+    std::uint64_t s = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) s += a[i];
+    double by_index = ms_since(t0);
+    sink = s;
+
+    t0 = Clock::now();
+    s = 0;
+    for (std::uint64_t v : a) s += v;
+    double by_iter = ms_since(t0);
+    sink = s;
+
+    t0 = Clock::now();
+    s = block_sum(a);
+    double by_block = ms_since(t0);
+    sink = s;
+    std::cout << "  " << name << ": operator[] " << by_index << " ms, iterator " << by_iter
+              << " ms, contiguous runs " << by_block << " ms\n";
+}
+
+template <typename Array>
+void random_access(const char* name, const Array& a, const DynamicArray<std::uint32_t>& idx) {
+    auto t0 = Clock::now();
+    std::uint64_t s = 0;
+    for (std::uint32_t i : idx) s += a[i];
+    sink = s;
+    std::cout << "  " << name << ": " << ms_since(t0) << " ms\n";
+}
+
+int main() {
+    std::cout << "Benchmark: " << N << " uint64_t\n\nappend\n";
+    append<DynamicArray<std::uint64_t>>("DynamicArray  ");
+    append<SegmentedArray<std::uint64_t>>("SegmentedArray");
+
+    DynamicArray<std::uint64_t> dyn;
+    SegmentedArray<std::uint64_t> seg;
+    for (std::size_t i = 0; i < N; ++i) {
+        dyn.push_back(i);
+        seg.push_back(i);
+    }
+
+    std::cout << "\nsequential scan\n";
+    scan("DynamicArray  ", dyn, [](const DynamicArray<std::uint64_t>& a){
+        std::uint64_t s = 0;
+        const std::uint64_t* p = a.data();
+        for (std::size_t i = 0; i < a.size(); ++i) s += p[i];
+        return s;
+    });
+    scan("SegmentedArray", seg, [](const SegmentedArray<std::uint64_t>& a){
+        std::uint64_t s = 0;
+        a.for_each_block([&](const std::uint64_t* p, std::size_t n){
+            for (std::size_t i = 0; i < n; ++i) s += p[i];
+        });
+        return s;
+    });
+
+    DynamicArray<std::uint32_t> idx;
+    idx.reserve(N);
+    std::mt19937 rng(5);
+    for (std::size_t i = 0; i < N; ++i) idx.push_back(static_cast<std::uint32_t>(rng() % N));
+    std::cout << "\nrandom access (" << N << " lookups)\n";
+    random_access("DynamicArray  ", dyn, idx);
+    random_access("SegmentedArray", seg, idx);
+    return 0;
+}
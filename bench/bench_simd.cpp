@@ -0,0 +1,74 @@
+#include "../src/simd.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+// Throughput (GB/s of input scanned) of the simd kernels on each ISA the CPU
+// supports, over a 64 MB array, next to the plain scalar loop.
+// find and count look for a value that is not in the array, so every kernel
+// reads the whole input.
+
+constexpr std::size_t BYTES = std::size_t(64) << 20;
+constexpr int TRIES = 7;
+
+template <typename F>
+double median_seconds(F&& f) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        t[i] = std::chrono::duration<double>(t1 - t0).count();
+    }
+    std::sort(t, t + TRIES);
+    return t[TRIES / 2];
+}
+
+volatile double sink;
+
+template <typename T>
+void run(const char* type_name, const DynamicArray<T>& arr, T absent) {
+    const double gb = static_cast<double>(arr.size() * sizeof(T)) / 1e9;
+    std::cout << type_name << " (" << arr.size() << " elements)\n";
+    std::cout << "  " << std::left << std::setw(8) << "isa"
+              << std::right << std::setw(10) << "find" << std::setw(10) << "count"
+              << std::setw(10) << "min" << std::setw(10) << "max" << std::setw(10) << "sum" << "  GB/s\n";
+
+    for (simd::Isa isa : {simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2}) {
+        if (!simd::supported(isa)) continue;
+        simd::set_isa(isa);
+        const char* name = isa == simd::Isa::avx2 ? "avx2" : isa == simd::Isa::sse2 ? "sse2" : "scalar";
+        double find_s  = median_seconds([&]{ sink = static_cast<double>(simd::find(arr, absent)); });
+        double count_s = median_seconds([&]{ sink = static_cast<double>(simd::count(arr, absent)); });
+        double min_s   = median_seconds([&]{ sink = static_cast<double>(simd::min(arr)); });
+        double max_s   = median_seconds([&]{ sink = static_cast<double>(simd::max(arr)); });
+        double sum_s   = median_seconds([&]{ sink = static_cast<double>(simd::sum(arr)); });
+        std::cout << "  " << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << gb / find_s << std::setw(10) << gb / count_s
+                  << std::setw(10) << gb / min_s << std::setw(10) << gb / max_s
+                  << std::setw(10) << gb / sum_s << "\n";
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    std::mt19937_64 rng(1);
+    DynamicArray<std::int32_t> ints;
+    DynamicArray<float> floats;
+    DynamicArray<std::uint64_t> u64s;
+    ints.reserve(BYTES / sizeof(std::int32_t));
+    floats.reserve(BYTES / sizeof(float));
+    u64s.reserve(BYTES / sizeof(std::uint64_t));
+    for (std::size_t i = 0; i < BYTES / sizeof(std::int32_t); ++i) ints.push_back(static_cast<std::int32_t>(rng() % 1000000));
+    for (std::size_t i = 0; i < BYTES / sizeof(float); ++i) floats.push_back(static_cast<float>(rng() % 1000000) * 0.25f);
+    for (std::size_t i = 0; i < BYTES / sizeof(std::uint64_t); ++i) u64s.push_back(rng() >> 1);
+
+    std::cout << "Benchmark: simd kernels, median of " << TRIES << " runs\n\n";
+    run("int32_t", ints, std::int32_t(-1));
+    run("float", floats, -1.0f);
+    run("uint64_t", u64s, ~std::uint64_t(0));
+    return 0;
+}
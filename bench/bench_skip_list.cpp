@@ -0,0 +1,156 @@
+#include "../src/skip_list.hpp"
+#include "../src/concurrent_skip_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Ordered maps of 64-bit keys to 64-bit values.
+//  - single thread: insert N random keys, then look up N random present
+//    keys; SkipListMap and ConcurrentSkipListMap vs. std::map
+//  - threads: T threads run OPS lookups-or-inserts between them on a map
+//    prefilled with N keys (90% lookup / 10% insert, then 50/50);
+//    ConcurrentSkipListMap vs. std::map under one std::mutex
+// Reported as million ops per second, median of TRIES.
+
+using Clock = std::chrono::steady_clock;
+constexpr std::size_t N = 1 << 18;
+constexpr std::size_t OPS = 1000000;
+constexpr int TRIES = 3;
+
+template <typename F>
+double mops(std::size_t ops, F fn){
+    double t[TRIES];
+    for(int i = 0; i < TRIES; ++i){
+        auto t0 = Clock::now();
+        fn();
+        t[i] = std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+    std::sort(t, t + TRIES);
+    return ops / t[TRIES / 2] / 1e6;
+}
+
+struct LockedMap{
+    std::mutex m;
+    std::map<std::uint64_t, std::uint64_t> map;
+    bool insert(std::uint64_t k, std::uint64_t v){
+        std::lock_guard<std::mutex> g(m);
+        return map.emplace(k, v).second;
+    }
+    bool contains(std::uint64_t k){
+        std::lock_guard<std::mutex> g(m);
+        return map.find(k) != map.end();
+    }
+};
+
+struct Concurrent{
+    ConcurrentSkipListMap<std::uint64_t, std::uint64_t> map;
+    bool insert(std::uint64_t k, std::uint64_t v){ return map.emplace(k, v); }
+    bool contains(std::uint64_t k){ return map.contains(k); }
+};
+
+std::vector<std::uint64_t> random_keys(std::size_t n, std::uint32_t seed){
+    std::mt19937_64 rng(seed);
+    std::vector<std::uint64_t> keys(n);
+    for(auto& k : keys) k = rng();
+    return keys;
+}
+
+template <typename Map>
+void single_thread_row(const char* name, const std::vector<std::uint64_t>& keys,
+                       const std::vector<std::uint64_t>& probes){
+    volatile std::size_t sink = 0;
+    double ins = mops(keys.size(), [&]{
+        Map m;
+        for(std::uint64_t k : keys) m.insert({k, k});
+        sink = sink + m.size();
+    });
+    Map m;
+    for(std::uint64_t k : keys) m.insert({k, k});
+    double find = mops(probes.size(), [&]{
+        std::size_t hits = 0;
+        for(std::uint64_t k : probes) hits += m.find(k) != m.end();
+        sink = sink + hits;
+    });
+    std::cout << "  " << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << ins << std::setw(10) << find << "\n";
+}
+
+// the prefill is not timed
+template <typename Map>
+double threaded(std::size_t threads, unsigned insert_percent, const std::vector<std::uint64_t>& keys){
+    double times[TRIES];
+    for(int i = 0; i < TRIES; ++i){
+        Map m;
+        for(std::size_t k = 0; k < N; ++k) m.insert(keys[k], keys[k]);
+        std::atomic<std::size_t> sink{0};
+        auto t0 = Clock::now();
+        DynamicArray<std::thread> workers;
+        for(std::size_t t = 0; t < threads; ++t){
+            workers.emplace_back([&, t]{
+                std::mt19937_64 rng(t + 1);
+                std::size_t hits = 0;
+                for(std::size_t i = t; i < OPS; i += threads){
+                    std::uint64_t r = rng();
+                    if(r % 100 < insert_percent) hits += m.insert(r, r);
+                    else hits += m.contains(keys[r % N]);
+                }
+                sink.fetch_add(hits);
+            });
+        }
+        for(auto& w : workers) w.join();
+        times[i] = std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+    std::sort(times, times + TRIES);
+    return OPS / times[TRIES / 2] / 1e6;
+}
+
+int main(){
+    std::vector<std::uint64_t> keys = random_keys(N, 1);
+    std::vector<std::uint64_t> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(2));
+
+    std::cout << "Benchmark: " << N << " random 64-bit keys (M ops/s, median of " << TRIES << ", "
+              << std::thread::hardware_concurrency() << " hardware threads)\n\n";
+    std::cout << "single thread" << std::setw(29) << "insert" << std::setw(10) << "find" << "\n";
+    single_thread_row<SkipListMap<std::uint64_t, std::uint64_t>>("SkipListMap", keys, probes);
+    single_thread_row<std::map<std::uint64_t, std::uint64_t>>("std::map", keys, probes);
+    {
+        // ConcurrentSkipListMap::find returns a pointer, not an iterator
+        volatile std::size_t sink = 0;
+        double ins = mops(N, [&]{
+            ConcurrentSkipListMap<std::uint64_t, std::uint64_t> m;
+            for(std::uint64_t k : keys) m.insert({k, k});
+            sink = sink + m.size();
+        });
+        ConcurrentSkipListMap<std::uint64_t, std::uint64_t> m;
+        for(std::uint64_t k : keys) m.insert({k, k});
+        double find = mops(N, [&]{
+            std::size_t hits = 0;
+            for(std::uint64_t k : probes) hits += m.find(k) != nullptr;
+            sink = sink + hits;
+        });
+        std::cout << "  " << std::left << std::setw(30) << "ConcurrentSkipListMap" << std::right
+                  << std::setw(10) << ins << std::setw(10) << find << "\n";
+    }
+
+    for(unsigned insert_percent : {10u, 50u}){
+        std::cout << "\n" << OPS << " ops, " << 100 - insert_percent << "% find / " << insert_percent << "% insert\n"
+                  << std::setw(9) << "threads" << std::setw(24) << "ConcurrentSkipListMap"
+                  << std::setw(18) << "mutex+std::map" << "\n";
+        for(std::size_t t : {1, 2, 4, 8}){
+            std::cout << std::setw(9) << t << std::fixed << std::setprecision(2)
+                      << std::setw(24) << threaded<Concurrent>(t, insert_percent, keys)
+                      << std::setw(18) << threaded<LockedMap>(t, insert_percent, keys) << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "../src/dynamic_array.hpp"
+#include "../src/small_dynamic_array.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+// Create, fill and destroy many small arrays: DynamicArray pays a heap
+// allocation per growth step, SmallDynamicArray<T, 8> none below 8 elements.
+
+template <typename F>
+long run_once(F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+const int TRIES = 5;
+
+template <typename F>
+long median_time(F fn) {
+    std::vector<long> times;
+    for (int t = 0; t < TRIES; ++t) times.push_back(run_once(fn));
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+template <typename Array>
+long bench(long arrays, int elems) {
+    volatile long sink = 0;
+    return median_time([&]() {
+        for (long n = 0; n < arrays; ++n) {
+            Array a;
+            for (int i = 0; i < elems; ++i) a.push_back(i);
+            long s = 0;
+            for (int v : a) s += v;
+            sink = sink + s;
+        }
+    });
+}
+
+int main() {
+    const long ARRAYS = 2000000;
+    std::cout << "Benchmark: ARRAYS=" << ARRAYS << " TRIES=" << TRIES << " (median)\n\n";
+    for (int elems : {1, 4, 8, 16}) {
+        long dyn = bench<DynamicArray<int>>(ARRAYS, elems);
+        long small = bench<SmallDynamicArray<int, 8>>(ARRAYS, elems);
+        std::cout << elems << " elements: DynamicArray us: " << dyn
+                  << "   SmallDynamicArray<int, 8> us: " << small << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "../src/sort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+// std::sort vs sorting::radix_sort vs sorting::parallel_sort on random
+// uint32_t, uint64_t and 16-byte key-payload records, from 1M elements up to
+// max_M million (x10 steps).
+//
+//   ./bench_sort [max_M]      (default 10; 100 needs ~4 GB of RAM)
+
+constexpr int TRIES = 3;
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t payload;
+};
+
+template <typename T, typename F>
+double median_ms(const DynamicArray<T>& input, F&& sort_fn) {
+    double t[TRIES];
+    for (int i = 0; i < TRIES; ++i) {
+        DynamicArray<T> a = input;
+        auto t0 = std::chrono::steady_clock::now();
+        sort_fn(a);
+        auto t1 = std::chrono::steady_clock::now();
+        t[i] = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+    std::sort(t, t + TRIES);
+    return t[TRIES / 2];
+}
+
+template <typename T, typename Gen, typename Key, typename Less>
+void run(const char* name, std::size_t n, ThreadPool& pool, Gen gen, Key key, Less less) {
+    DynamicArray<T> input;
+    input.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) input.push_back(gen());
+    DynamicArray<T> scratch;
+
+    double std_ms = median_ms(input, [&](DynamicArray<T>& a){ std::sort(a.begin(), a.end(), less); });
+    double radix_ms = median_ms(input, [&](DynamicArray<T>& a){ sorting::radix_sort(a, scratch, key); });
+    double par_ms = median_ms(input, [&](DynamicArray<T>& a){ sorting::parallel_sort(pool, a, less); });
+    std::cout << std::left << std::setw(10) << name << std::right << std::setw(6) << n / 1000000 << "M"
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << std_ms << std::setw(12) << radix_ms << std::setw(12) << par_ms
+              << "    radix x" << std::setprecision(2) << std_ms / radix_ms
+              << ", parallel x" << std_ms / par_ms << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_m = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10;
+    ThreadPool pool;
+    std::mt19937_64 rng(3);
+    std::cout << "Benchmark: sorting (ms, median of " << TRIES << "), parallel_sort on "
+              << pool.size() << " threads\n\n";
+    std::cout << std::left << std::setw(17) << "type / n" << std::right
+              << std::setw(12) << "std::sort" << std::setw(12) << "radix" << std::setw(12) << "parallel" << "\n";
+
+    for (std::size_t m = 1; m <= max_m; m *= 10) {
+        std::size_t n = m * 1000000;
+        run<std::uint32_t>("uint32_t", n, pool, [&]{ return static_cast<std::uint32_t>(rng()); },
+                           [](std::uint32_t v){ return v; }, std::less<>());
+        run<std::uint64_t>("uint64_t", n, pool, [&]{ return static_cast<std::uint64_t>(rng()); },
+                           [](std::uint64_t v){ return v; }, std::less<>());
+        run<Record>("record", n, pool, [&]{ return Record{rng(), 0}; },
+                    [](const Record& r){ return r.key; },
+                    [](const Record& a, const Record& b){ return a.key < b.key; });
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "../src/spsc_ring_buffer.hpp"
+#include "../src/doubly_linked_list.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Two pipeline stages on two threads, pinned to CPUs 0 and 1 where the
+// machine has them (both to CPU 0 otherwise).
+//  - throughput: TOTAL 64-bit messages from producer to consumer, through
+//    SpscRingBuffer one at a time, SpscRingBuffer in batches of BATCH, and
+//    a std::mutex-guarded DoublyLinkedList; million messages per second
+//  - latency: PINGS round trips of one message over a pair of rings
+//    (ping, then pong back), reported as median and 99th percentile one-way
+//    time (half the round trip)
+// Median of TRIES for throughput.
+
+using Clock = std::chrono::steady_clock;
+constexpr std::size_t TOTAL = 20000000;
+constexpr std::size_t CAPACITY = 4096;
+constexpr std::size_t BATCH = 64;
+constexpr std::size_t PINGS = 200000;
+constexpr int TRIES = 3;
+
+static void pin_to(unsigned cpu){
+#ifdef __linux__
+    unsigned cpus = std::thread::hardware_concurrency();
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpus > 1 ? cpu % cpus : 0, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// wait politely: with both threads on one core, spinning would burn the
+// other side's time slice
+static void relax(){
+    if(std::thread::hardware_concurrency() < 2) std::this_thread::yield();
+}
+
+struct LockedList{
+    std::mutex m;
+    DoublyLinkedList<std::uint64_t> l;
+    bool try_push(std::uint64_t v){
+        std::lock_guard<std::mutex> g(m);
+        l.push_back(v);
+        return true;
+    }
+    bool try_pop(std::uint64_t& out){
+        std::lock_guard<std::mutex> g(m);
+        if(l.empty()) return false;
+        out = l.head()->data;
+        l.pop_front();
+        return true;
+    }
+};
+
+enum class Mode { single, batch };
+
+template <Mode M, typename Q>
+double run_once(Q& q){
+    std::uint64_t sum = 0;
+    auto t0 = Clock::now();
+    std::thread producer([&q]{
+        pin_to(0);
+        std::uint64_t batch[BATCH];
+        for(std::uint64_t i = 0; i < TOTAL;){
+            if constexpr (M == Mode::batch){
+                std::size_t n = std::min<std::uint64_t>(BATCH, TOTAL - i);
+                for(std::size_t j = 0; j < n; ++j) batch[j] = i + j;
+                std::size_t k = q.try_push_n(batch, n);
+                i += k;
+                if(k == 0) relax();
+            }
+            else{
+                if(q.try_push(i)) ++i;
+                else relax();
+            }
+        }
+    });
+    std::thread consumer([&q, &sum]{
+        pin_to(1);
+        std::uint64_t batch[BATCH];
+        std::uint64_t local = 0;
+        for(std::size_t seen = 0; seen < TOTAL;){
+            std::size_t k = 0;
+            if constexpr (M == Mode::batch) k = q.try_pop_n(batch, BATCH);
+            else k = q.try_pop(batch[0]) ? 1 : 0;
+            if(k == 0){ relax(); continue; }
+            for(std::size_t j = 0; j < k; ++j) local += batch[j];
+            seen += k;
+        }
+        sum = local;
+    });
+    producer.join();
+    consumer.join();
+    double t = std::chrono::duration<double>(Clock::now() - t0).count();
+    if(sum != TOTAL * (TOTAL - 1) / 2) std::cout << "lost messages!\n";
+    return t;
+}
+
+template <Mode M, typename Make>
+double mmsgs(Make make){
+    double t[TRIES];
+    for(int i = 0; i < TRIES; ++i){
+        auto q = make();
+        t[i] = run_once<M>(*q);
+    }
+    std::sort(t, t + TRIES);
+    return TOTAL / t[TRIES / 2] / 1e6;
+}
+
+// one-way latency in ns: median and 99th percentile of half round trips
+static void ping_pong(){
+    SpscRingBuffer<std::uint64_t> ping(CAPACITY), pong(CAPACITY);
+    std::vector<double> half_rtt(PINGS);
+    std::thread echo([&]{
+        pin_to(1);
+        std::uint64_t v;
+        for(std::size_t i = 0; i < PINGS; ++i){
+            while(!ping.try_pop(v)) relax();
+            while(!pong.try_push(v)) relax();
+        }
+    });
+    pin_to(0);
+    for(std::size_t i = 0; i < PINGS; ++i){
+        std::uint64_t v;
+        auto t0 = Clock::now();
+        ping.try_push(i);
+        while(!pong.try_pop(v)) relax();
+        half_rtt[i] = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / 2;
+    }
+    echo.join();
+    std::sort(half_rtt.begin(), half_rtt.end());
+    std::cout << "\nlatency (one way, " << PINGS << " ping-pongs): median " << std::setprecision(0)
+              << half_rtt[PINGS / 2] << " ns, p99 " << half_rtt[PINGS * 99 / 100] << " ns\n";
+}
+
+int main(){
+    std::cout << "Benchmark: " << TOTAL << " messages between two threads, ring capacity " << CAPACITY
+              << " (M msgs/s, median of " << TRIES << ", " << std::thread::hardware_concurrency()
+              << " hardware threads)\n\n" << std::fixed << std::setprecision(1);
+    auto ring = []{ return std::make_unique<SpscRingBuffer<std::uint64_t>>(CAPACITY); };
+    auto list = []{ return std::make_unique<LockedList>(); };
+    std::cout << "  " << std::left << std::setw(34) << "SpscRingBuffer try_push/try_pop" << std::right
+              << std::setw(8) << mmsgs<Mode::single>(ring) << "\n";
+    std::cout << "  " << std::left << std::setw(34) << "SpscRingBuffer batches of 64" << std::right
+              << std::setw(8) << mmsgs<Mode::batch>(ring) << "\n";
+    std::cout << "  " << std::left << std::setw(34) << "mutex + DoublyLinkedList" << std::right
+              << std::setw(8) << mmsgs<Mode::single>(list) << "\n";
+    ping_pong();
+    return 0;
+}
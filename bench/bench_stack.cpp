@@ -0,0 +1,65 @@
+#include "../src/stack.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+// Deep-then-shallow oscillation (iterative DFS / expression evaluation shape):
+// each cycle pushes to DEEP elements and pops back down to SHALLOW.
+// Counts buffer allocations made by the stack's allocator.
+
+static long allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(std::size_t n) { ++allocations; return std::allocator<T>().allocate(n); }
+    void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+};
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+const long DEEP = 100000;
+const long SHALLOW = 10;
+const int CYCLES = 200;
+
+template <typename S>
+void one_by_one(const char* name) {
+    S s;
+    allocations = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int c = 0; c < CYCLES; ++c) {
+        for (long i = 0; static_cast<long>(s.size()) < DEEP; ++i) s.push(i);
+        while (static_cast<long>(s.size()) > SHALLOW) s.pop();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << name << ": " << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()
+              << " us, " << allocations << " allocations\n";
+}
+
+template <typename S>
+void bulk(const char* name) {
+    S s;
+    long values[256];
+    for (long i = 0; i < 256; ++i) values[i] = i;
+    allocations = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int c = 0; c < CYCLES; ++c) {
+        while (static_cast<long>(s.size()) + 256 <= DEEP) s.push_n(values, values + 256);
+        s.pop_n(s.size() - SHALLOW);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << name << ": " << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()
+              << " us, " << allocations << " allocations\n";
+}
+
+int main() {
+    std::cout << "Benchmark: " << CYCLES << " cycles of push to " << DEEP << ", pop to " << SHALLOW << "\n\n";
+    one_by_one<Stack<long, CountingAllocator<long>, DefaultGrowthPolicy>>("push/pop, auto-shrink (old behaviour)");
+    one_by_one<Stack<long, CountingAllocator<long>>>("push/pop, retain capacity (default)  ");
+    bulk<Stack<long, CountingAllocator<long>>>("push_n/pop_n, retain capacity        ");
+    return 0;
+}
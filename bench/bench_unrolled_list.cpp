@@ -0,0 +1,89 @@
+#include "../src/unrolled_linked_list.hpp"
+#include "../src/linked_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+// LinkedList vs UnrolledLinkedList vs DynamicArray on uint64_t:
+//  - walk packed: sum N elements that were appended with push_back
+//  - insert: build a container by INSERTS inserts at random indexes
+//  - walk inserted: sum that container (its linked nodes are scattered and
+//    the unrolled nodes only partly filled)
+
+using Clock = std::chrono::steady_clock;
+const int TRIES = 5;
+
+template <typename F>
+long median_us(F fn) {
+    std::vector<long> times;
+    for (int t = 0; t < TRIES; ++t) {
+        auto t0 = Clock::now();
+        fn();
+        auto t1 = Clock::now();
+        times.push_back(static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()));
+    }
+    std::sort(times.begin(), times.end());
+    return times[TRIES / 2];
+}
+
+template <typename C>
+std::uint64_t sum(const C& c) {
+    std::uint64_t s = 0;
+    for (std::uint64_t v : c) s += v;
+    return s;
+}
+
+// random indexes are drawn up front so every container sees the same ones
+template <typename C>
+void build_by_inserts(C& c, const std::vector<std::uint32_t>& picks) {
+    for (std::size_t i = 0; i < picks.size(); ++i) c.insert_at(picks[i] % (c.size() + 1), std::uint64_t(i));
+}
+
+template <>
+void build_by_inserts(DynamicArray<std::uint64_t>& c, const std::vector<std::uint32_t>& picks) {
+    for (std::size_t i = 0; i < picks.size(); ++i) c.insert(picks[i] % (c.size() + 1), std::uint64_t(i));
+}
+
+template <typename C>
+void row(const char* name, std::size_t n, const std::vector<std::uint32_t>& picks) {
+    volatile std::uint64_t sink = 0;
+    C packed;
+    for (std::size_t i = 0; i < n; ++i) packed.push_back(i);
+    long walk_packed = median_us([&]{ sink = sink + sum(packed); });
+
+    long insert = median_us([&]{
+        C c;
+        build_by_inserts(c, picks);
+    });
+    C scattered;
+    build_by_inserts(scattered, picks);
+    long walk_scattered = median_us([&]{ sink = sink + sum(scattered); });
+
+    std::cout << "  " << std::left << std::setw(22) << name << std::right
+              << std::setw(14) << walk_packed << std::setw(12) << insert
+              << std::setw(16) << walk_scattered << "\n";
+}
+
+int main() {
+    const std::size_t N = 1 << 22;          // elements traversed
+    const std::size_t INSERTS = 1 << 15;    // random inserts (quadratic for LinkedList)
+
+    std::mt19937 rng(1);
+    std::vector<std::uint32_t> picks(INSERTS);
+    for (auto& p : picks) p = rng();
+
+    std::cout << "Benchmark: walk " << N << " uint64_t appended with push_back; build by "
+              << INSERTS << " random inserts, then walk that; TRIES=" << TRIES << " (median, us)\n\n"
+              << "  " << std::left << std::setw(22) << "" << std::right
+              << std::setw(14) << "walk packed" << std::setw(12) << "insert"
+              << std::setw(16) << "walk inserted" << "\n";
+    row<LinkedList<std::uint64_t>>("LinkedList", N, picks);
+    row<UnrolledLinkedList<std::uint64_t>>("UnrolledLinkedList", N, picks);
+    row<DynamicArray<std::uint64_t>>("DynamicArray", N, picks);
+    return 0;
+}
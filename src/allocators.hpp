@@ -0,0 +1,340 @@
+#ifndef ALLOCATORS_HPP
+#define ALLOCATORS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Memory resources and the std-compatible allocators that plug them into the
+// containers (DynamicArray<T, Allocator>, ...).
+//
+//  - ArenaResource / ArenaAllocator<T>: monotonic bump allocation. deallocate
+//    is a no-op; memory comes back all at once through release() or the
+//    resource destructor. Ideal for many short-lived containers.
+//  - PoolResource / PoolAllocator<T>: fixed-size blocks carved out of slabs
+//    and recycled through a free list. Requests larger than the block size
+//    fall through to ::operator new. A block size of 0 is fixed by the first
+//    request, which suits node-based containers whose node type is internal.
+//  - NodePoolAllocator<T>: a PoolAllocator that owns its (lazily sized)
+//    pool. A default-constructed one brings a private pool per container;
+//    copies share it, so handing one allocator to several containers makes
+//    them draw from a common pool.
+//
+// A resource must outlive every allocator (and container) that refers to it.
+// Resources are not thread-safe.
+
+namespace alloc_detail{
+
+    constexpr std::size_t align_up(std::size_t n, std::size_t align) noexcept{
+        return (n + align - 1) & ~(align - 1);
+    }
+
+    template <typename T>
+    std::size_t array_bytes(std::size_t n){
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return n * sizeof(T);
+    }
+
+} // namespace alloc_detail
+
+class ArenaResource{
+public:
+    using size_type = std::size_t;
+
+    explicit ArenaResource(size_type chunk_size = 64 * 1024)
+        : chunks_(nullptr), cur_(nullptr), end_(nullptr), chunk_size_(chunk_size) {}
+
+    ~ArenaResource(){
+        free_chunks(chunks_);
+    }
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+
+    void* allocate(size_type bytes, size_type align = alignof(std::max_align_t)){
+        std::uintptr_t p = alloc_detail::align_up(reinterpret_cast<std::uintptr_t>(cur_), align);
+        if(!cur_ || p + bytes > reinterpret_cast<std::uintptr_t>(end_)){
+            add_chunk(bytes + align);
+            p = alloc_detail::align_up(reinterpret_cast<std::uintptr_t>(cur_), align);
+        }
+        cur_ = reinterpret_cast<char*>(p + bytes);
+        return reinterpret_cast<void*>(p);
+    }
+
+    // monotonic: individual blocks are never reused
+    void deallocate(void*, size_type) noexcept {}
+
+    // Invalidates every block handed out so far. The most recent chunk is kept
+    // and reused, so a build/release loop stops touching the system allocator.
+    void release() noexcept{
+        if(!chunks_) return;
+        free_chunks(chunks_->next);
+        chunks_->next = nullptr;
+        cur_ = chunk_begin(chunks_);
+        end_ = reinterpret_cast<char*>(chunks_) + chunks_->size;
+    }
+
+private:
+    struct Chunk{
+        Chunk* next;
+        size_type size;   // total bytes including this header
+    };
+
+    Chunk* chunks_;       // most recent first
+    char* cur_;
+    char* end_;
+    size_type chunk_size_;
+
+    static char* chunk_begin(Chunk* c) noexcept{
+        return reinterpret_cast<char*>(c) + alloc_detail::align_up(sizeof(Chunk), alignof(std::max_align_t));
+    }
+
+    void add_chunk(size_type min_bytes){
+        size_type header = alloc_detail::align_up(sizeof(Chunk), alignof(std::max_align_t));
+        size_type size = header + (min_bytes > chunk_size_ ? min_bytes : chunk_size_);
+        Chunk* c = static_cast<Chunk*>(::operator new(size));
+        c->next = chunks_;
+        c->size = size;
+        chunks_ = c;
+        cur_ = chunk_begin(c);
+        end_ = reinterpret_cast<char*>(c) + size;
+    }
+
+    static void free_chunks(Chunk* c) noexcept{
+        while(c){
+            Chunk* next = c->next;
+            ::operator delete(c);
+            c = next;
+        }
+    }
+};
+
+class PoolResource{
+public:
+    using size_type = std::size_t;
+
+    // block_size == 0: the first allocate() sets the block size to its request,
+    // rounded up only as far as that request's alignment needs, so small nodes
+    // are packed densely instead of at max_align_t strides.
+    explicit PoolResource(size_type block_size, size_type blocks_per_slab = 256)
+        : free_(nullptr), slabs_(nullptr),
+          block_size_(block_size ? alloc_detail::align_up(block_size < sizeof(FreeBlock) ? sizeof(FreeBlock) : block_size,
+                                                          alignof(std::max_align_t))
+                                 : 0),
+          block_align_(alignof(std::max_align_t)),
+          blocks_per_slab_(blocks_per_slab ? blocks_per_slab : 1) {}
+
+    ~PoolResource(){
+        while(slabs_){
+            Slab* next = slabs_->next;
+            ::operator delete(slabs_);
+            slabs_ = next;
+        }
+    }
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    // 0 while a lazily sized pool has not served a request yet
+    size_type block_size() const noexcept { return block_size_; }
+
+    void* allocate(size_type bytes, size_type align = alignof(std::max_align_t)){
+        if(block_size_ == 0) fix_block_size(bytes, align);
+        if(bytes > block_size_ || align > block_align_){
+            return ::operator new(bytes, std::align_val_t(align));
+        }
+        if(!free_) add_slab();
+        FreeBlock* b = free_;
+        free_ = b->next;
+        return b;
+    }
+
+    void deallocate(void* p, size_type bytes, size_type align = alignof(std::max_align_t)) noexcept{
+        if(!p) return;
+        if(bytes > block_size_ || align > block_align_){
+            ::operator delete(p, std::align_val_t(align));
+            return;
+        }
+        FreeBlock* b = static_cast<FreeBlock*>(p);
+        b->next = free_;
+        free_ = b;
+    }
+
+private:
+    struct FreeBlock{ FreeBlock* next; };
+    struct Slab{ Slab* next; };
+
+    FreeBlock* free_;
+    Slab* slabs_;
+    size_type block_size_;
+    size_type block_align_;     // every block is aligned at least this much
+    size_type blocks_per_slab_;
+
+    void fix_block_size(size_type bytes, size_type align) noexcept{
+        if(align < alignof(FreeBlock)) align = alignof(FreeBlock);
+        if(align > alignof(std::max_align_t)) return;    // served by operator new anyway
+        block_size_ = alloc_detail::align_up(bytes < sizeof(FreeBlock) ? sizeof(FreeBlock) : bytes, align);
+        // slabs start max_align_t aligned, so a block stride of block_size_
+        // keeps each block aligned to the largest power of two dividing it
+        block_align_ = block_size_ & (~block_size_ + 1);
+        if(block_align_ > alignof(std::max_align_t)) block_align_ = alignof(std::max_align_t);
+    }
+
+    void add_slab(){
+        size_type header = alloc_detail::align_up(sizeof(Slab), alignof(std::max_align_t));
+        char* raw = static_cast<char*>(::operator new(header + block_size_ * blocks_per_slab_));
+        Slab* s = reinterpret_cast<Slab*>(raw);
+        s->next = slabs_;
+        slabs_ = s;
+        // thread the new blocks onto the free list, lowest address first
+        char* first = raw + header;
+        for(size_type i = blocks_per_slab_; i-- > 0;){
+            FreeBlock* b = reinterpret_cast<FreeBlock*>(first + i * block_size_);
+            b->next = free_;
+            free_ = b;
+        }
+    }
+};
+
+// Allocators referencing a resource. Containers that move or swap also carry
+// the resource pointer along (propagate_on_container_move_assignment/swap),
+// while a copy-assigned container keeps allocating from its own resource.
+
+template <typename T>
+class ArenaAllocator{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    explicit ArenaAllocator(ArenaResource& resource) noexcept : resource_(&resource) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource_(other.resource()) {}
+
+    T* allocate(std::size_t n){
+        return static_cast<T*>(resource_->allocate(alloc_detail::array_bytes<T>(n), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept{
+        resource_->deallocate(p, n * sizeof(T));
+    }
+
+    ArenaResource* resource() const noexcept { return resource_; }
+
+private:
+    ArenaResource* resource_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept{
+    return a.resource() == b.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept{
+    return !(a == b);
+}
+
+template <typename T>
+class PoolAllocator{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    explicit PoolAllocator(PoolResource& resource) noexcept : resource_(&resource) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : resource_(other.resource()) {}
+
+    T* allocate(std::size_t n){
+        return static_cast<T*>(resource_->allocate(alloc_detail::array_bytes<T>(n), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept{
+        resource_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    PoolResource* resource() const noexcept { return resource_; }
+
+private:
+    PoolResource* resource_;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept{
+    return a.resource() == b.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b) noexcept{
+    return !(a == b);
+}
+
+// PoolAllocator over a pool it owns jointly with its copies and rebinds.
+// Moving one copies it, so a moved-from container can still allocate.
+//
+//     LinkedList<int, NodePoolAllocator<int>> a;      // private pool
+//     NodePoolAllocator<Msg> shared;
+//     LinkedList<Msg, NodePoolAllocator<Msg>> b(shared), c(shared);
+template <typename T>
+class NodePoolAllocator{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    explicit NodePoolAllocator(std::size_t blocks_per_slab = 256)
+        : resource_(std::make_shared<PoolResource>(0, blocks_per_slab)) {}
+
+    NodePoolAllocator(const NodePoolAllocator& other) noexcept : resource_(other.resource_) {}
+
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U>& other) noexcept : resource_(other.shared_resource()) {}
+
+    NodePoolAllocator& operator=(const NodePoolAllocator& other) noexcept{
+        resource_ = other.resource_;
+        return *this;
+    }
+
+    // Only single objects (nodes) are pooled: arrays, such as a hash table's
+    // buckets, go to std::allocator so they cannot size the pool's blocks.
+    T* allocate(std::size_t n){
+        if(n != 1) return std::allocator<T>().allocate(n);
+        return static_cast<T*>(resource_->allocate(sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept{
+        if(n != 1) std::allocator<T>().deallocate(p, n);
+        else resource_->deallocate(p, sizeof(T), alignof(T));
+    }
+
+    PoolResource* resource() const noexcept { return resource_.get(); }
+    const std::shared_ptr<PoolResource>& shared_resource() const noexcept { return resource_; }
+
+private:
+    std::shared_ptr<PoolResource> resource_;
+};
+
+template <typename T, typename U>
+bool operator==(const NodePoolAllocator<T>& a, const NodePoolAllocator<U>& b) noexcept{
+    return a.resource() == b.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const NodePoolAllocator<T>& a, const NodePoolAllocator<U>& b) noexcept{
+    return !(a == b);
+}
+
+#endif /* ALLOCATORS_HPP */
@@ -0,0 +1,238 @@
+#ifndef ARRAY_FILE_HPP
+#define ARRAY_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "dynamic_array.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DS_HAS_MMAP_FILE 1
+#endif
+
+// On-disk format for arrays of trivially copyable T:
+//
+//     [ FileHeader, 64 bytes ][ count * sizeof(T) bytes of elements ]
+//
+// The header records the format version, element size and alignment, the
+// element count and a byte-order marker; a file only loads into an array of
+// the same element size and alignment on a machine of the same byte order.
+// Elements start at offset 64, so a page-aligned mapping keeps them aligned.
+//
+//     array_file::save(table, "table.bin");
+//     array_file::load(table, "table.bin");          // copy into a DynamicArray
+//     MappedArrayView<Entry> view("table.bin");      // or use the file in place
+//     if (view.is_open()) lookup(view[i]);
+namespace array_file{
+
+    constexpr std::uint32_t version = 1;
+    constexpr std::size_t header_size = 64;
+
+    struct FileHeader{
+        char magic[8];                 // "DSARRAY\0"
+        std::uint32_t version;
+        std::uint32_t byte_order;      // 0x01020304 as written by the saver
+        std::uint64_t header_size;     // offset of the first element
+        std::uint64_t elem_size;
+        std::uint64_t elem_align;
+        std::uint64_t count;
+        unsigned char reserved[16];
+    };
+    static_assert(sizeof(FileHeader) == header_size, "FileHeader must stay 64 bytes");
+
+    namespace detail{
+        constexpr char magic[8] = {'D', 'S', 'A', 'R', 'R', 'A', 'Y', '\0'};
+        constexpr std::uint32_t byte_order = 0x01020304;
+
+        template <typename T>
+        FileHeader make_header(std::uint64_t count) noexcept{
+            FileHeader h;
+            std::memset(&h, 0, sizeof h);
+            std::memcpy(h.magic, magic, sizeof magic);
+            h.version = version;
+            h.byte_order = byte_order;
+            h.header_size = header_size;
+            h.elem_size = sizeof(T);
+            h.elem_align = alignof(T);
+            h.count = count;
+            return h;
+        }
+
+        // true when h describes count elements of T in a file of file_bytes
+        template <typename T>
+        bool header_matches(const FileHeader& h, std::uint64_t file_bytes) noexcept{
+            if(std::memcmp(h.magic, magic, sizeof magic) != 0) return false;
+            if(h.version != version || h.byte_order != byte_order) return false;
+            if(h.header_size != header_size) return false;
+            if(h.elem_size != sizeof(T) || h.elem_align != alignof(T)) return false;
+            if(h.count > (file_bytes - header_size) / sizeof(T)) return false;
+            return file_bytes - header_size == h.count * sizeof(T);
+        }
+    } // namespace detail
+
+    // Writes arr to path, replacing any existing file. Returns false on any
+    // I/O error (the file may then be partially written).
+    template <typename T, typename A, typename P>
+    bool save(const DynamicArray<T, A, P>& arr, const char* path){
+        static_assert(std::is_trivially_copyable<T>::value, "array_file needs a trivially copyable type");
+        std::FILE* f = std::fopen(path, "wb");
+        if(!f) return false;
+        FileHeader h = detail::make_header<T>(arr.size());
+        bool ok = std::fwrite(&h, sizeof h, 1, f) == 1;
+        if(ok && arr.size() > 0) ok = std::fwrite(arr.data(), sizeof(T), arr.size(), f) == arr.size();
+        if(std::fclose(f) != 0) ok = false;
+        return ok;
+    }
+
+    // Replaces the contents of arr with the array stored at path. Returns
+    // false, leaving arr unchanged, if the file is missing, unreadable, or
+    // was written for a different element type or byte order.
+    template <typename T, typename A, typename P>
+    bool load(DynamicArray<T, A, P>& arr, const char* path){
+        static_assert(std::is_trivially_copyable<T>::value, "array_file needs a trivially copyable type");
+        std::FILE* f = std::fopen(path, "rb");
+        if(!f) return false;
+        FileHeader h;
+        bool ok = std::fread(&h, sizeof h, 1, f) == 1
+               && std::fseek(f, 0, SEEK_END) == 0;
+        long end = ok ? std::ftell(f) : -1;
+        ok = ok && end >= static_cast<long>(header_size)
+                && detail::header_matches<T>(h, static_cast<std::uint64_t>(end))
+                && std::fseek(f, static_cast<long>(header_size), SEEK_SET) == 0;
+        if(ok){
+            DynamicArray<T, A, P> temp(arr.get_allocator());
+            if constexpr (std::is_trivially_default_constructible<T>::value){
+                temp.resize_for_overwrite(h.count);
+            }
+            else{
+                temp.resize(h.count);
+            }
+            ok = h.count == 0 || std::fread(temp.data(), sizeof(T), h.count, f) == h.count;
+            if(ok) arr.swap(temp);
+        }
+        std::fclose(f);
+        return ok;
+    }
+
+} // namespace array_file
+
+// Read-only view of an array file mapped into memory. Nothing is copied:
+// pages are faulted in from the page cache on first touch, so opening is
+// O(1) regardless of the file size. The view is move-only and unmaps on
+// destruction. On platforms without mmap, open() always fails.
+template <typename T>
+class MappedArrayView{
+    static_assert(std::is_trivially_copyable<T>::value, "array_file needs a trivially copyable type");
+    static_assert(alignof(T) <= array_file::header_size, "element alignment exceeds the header size");
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    MappedArrayView() noexcept
+        :base_(nullptr), bytes_(0), data_(nullptr), size_(0) {}
+
+    explicit MappedArrayView(const char* path) noexcept
+        :MappedArrayView()
+    {
+        open(path);
+    }
+
+    MappedArrayView(MappedArrayView&& other) noexcept
+        :MappedArrayView()
+    {
+        swap(other);
+    }
+
+    MappedArrayView& operator=(MappedArrayView&& other) noexcept{
+        if(this != &other){
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    MappedArrayView(const MappedArrayView&) = delete;
+    MappedArrayView& operator=(const MappedArrayView&) = delete;
+
+    ~MappedArrayView(){
+        close();
+    }
+
+    // Maps path, replacing any current mapping. Returns false (and leaves
+    // the view closed) if the file is missing or does not hold an array of T.
+    bool open(const char* path) noexcept{
+        close();
+#if defined(DS_HAS_MMAP_FILE)
+        int fd = ::open(path, O_RDONLY);
+        if(fd < 0) return false;
+        struct stat st;
+        if(::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(array_file::header_size)){
+            ::close(fd);
+            return false;
+        }
+        std::size_t bytes = static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);                                  // the mapping keeps the file alive
+        if(p == MAP_FAILED) return false;
+        array_file::FileHeader h;
+        std::memcpy(&h, p, sizeof h);
+        if(!array_file::detail::header_matches<T>(h, bytes)){
+            ::munmap(p, bytes);
+            return false;
+        }
+        base_ = p;
+        bytes_ = bytes;
+        data_ = reinterpret_cast<const T*>(static_cast<const unsigned char*>(p) + array_file::header_size);
+        size_ = static_cast<size_type>(h.count);
+        return true;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    void close() noexcept{
+#if defined(DS_HAS_MMAP_FILE)
+        if(base_) ::munmap(base_, bytes_);
+#endif
+        base_ = nullptr;
+        bytes_ = 0;
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    bool is_open() const noexcept { return base_ != nullptr; }
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const T& operator[](size_type index) const {
+        assert(index < size_ && "index out of bound");
+        return data_[index];
+    }
+
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+    const T* data() const noexcept { return data_; }
+
+    void swap(MappedArrayView& other) noexcept{
+        std::swap(base_, other.base_);
+        std::swap(bytes_, other.bytes_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    void* base_;
+    std::size_t bytes_;
+    const T* data_;
+    size_type size_;
+};
+
+#endif /* ARRAY_FILE_HPP */
@@ -0,0 +1,340 @@
+#ifndef COMPACT_LIST_HPP
+#define COMPACT_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "dynamic_array.hpp"
+#include "relocation.hpp"
+
+namespace compact_detail{
+
+    using index_type = std::uint32_t;
+
+    constexpr index_type npos = 0xFFFFFFFFu;     // no node: end of the list
+    constexpr index_type free_mark = 0xFFFFFFFEu; // prev of a slot on the free chain
+
+    // One slot of a CompactList: a value and two 32-bit links into the same
+    // array. A free slot holds no value; its next links the free chain.
+    template <typename T>
+    struct Node{
+        alignas(T) unsigned char storage[sizeof(T)];
+        index_type prev;
+        index_type next;
+
+        template <typename... Args>
+        explicit Node(index_type p, index_type n, Args&&... args) : prev(p), next(n){
+            ::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+        }
+
+        Node(const Node& other) : prev(other.prev), next(other.next){
+            if(other.live()) ::new (static_cast<void*>(storage)) T(*other.value());
+        }
+
+        Node(Node&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            : prev(other.prev), next(other.next)
+        {
+            if(other.live()) ::new (static_cast<void*>(storage)) T(std::move(*other.value()));
+        }
+
+        Node& operator=(const Node&) = delete;
+        Node& operator=(Node&&) = delete;
+
+        ~Node(){ if(live()) value()->~T(); }
+
+        bool live() const noexcept { return prev != free_mark; }
+        T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* value() const noexcept { return std::launder(reinterpret_cast<const T*>(storage)); }
+
+        // ends the value's lifetime and puts the slot on the free chain
+        void release(index_type free_head) noexcept{
+            value()->~T();
+            prev = free_mark;
+            next = free_head;
+        }
+    };
+
+} // namespace compact_detail
+
+// A slot moves with its value's bytes when the value's do.
+template <typename T>
+struct is_trivially_relocatable<compact_detail::Node<T>> : is_trivially_relocatable<T> {};
+
+// Doubly linked list whose nodes live in one contiguous DynamicArray and
+// link to each other by 32-bit index instead of by pointer. A node costs
+// sizeof(T) plus 8 bytes (rounded up to T's alignment) and no per-node
+// allocation; erased slots go on a free chain and are reused before the
+// array grows. Storage is never returned on erase: call compact() to pack it.
+//
+// The index a node sits at is its handle: emplace_* return it, and it stays
+// valid until the node is erased or compact() runs. Pointers, references and
+// iterators, however, are invalidated whenever the array grows.
+//
+//     CompactList<int> l;
+//     auto h = l.push_back(7);
+//     l.push_front(3);
+//     l.erase(h);                                   // O(1), slot is reused
+//     for(int& x : l) ...
+//
+// At most 2^32 - 2 nodes.
+template <typename T>
+class CompactList{
+    using Node = compact_detail::Node<T>;
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using index_type = compact_detail::index_type;
+
+    static constexpr index_type npos = compact_detail::npos;
+
+class const_iterator;
+
+class iterator{
+    friend class CompactList;
+    friend class const_iterator;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    iterator() noexcept : nodes_(nullptr), index_(npos) {}
+
+    reference operator*()  const { return *nodes_[index_].value(); }
+    pointer   operator->() const { return nodes_[index_].value(); }
+
+    iterator& operator++(){
+        index_ = nodes_[index_].next;
+        return *this;
+    }
+    iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+
+    bool operator==(const iterator& other) const { return index_ == other.index_; }
+    bool operator!=(const iterator& other) const { return !(*this == other); }
+
+    index_type handle() const noexcept { return index_; }
+
+private:
+    iterator(Node* nodes, index_type index) noexcept : nodes_(nodes), index_(index) {}
+    Node* nodes_;
+    index_type index_;
+};
+
+class const_iterator{
+    friend class CompactList;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    const_iterator() noexcept : nodes_(nullptr), index_(npos) {}
+    const_iterator(const iterator& it) noexcept : nodes_(it.nodes_), index_(it.index_) {}
+
+    reference operator*()  const { return *nodes_[index_].value(); }
+    pointer   operator->() const { return nodes_[index_].value(); }
+
+    const_iterator& operator++(){
+        index_ = nodes_[index_].next;
+        return *this;
+    }
+    const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+
+    bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    index_type handle() const noexcept { return index_; }
+
+private:
+    const_iterator(const Node* nodes, index_type index) noexcept : nodes_(nodes), index_(index) {}
+    const Node* nodes_;
+    index_type index_;
+};
+
+    CompactList() noexcept : head_(npos), tail_(npos), free_(npos), size_(0) {}
+
+    // Copies keep the slot layout, so handles carry over to the copy.
+    CompactList(const CompactList&) = default;
+    CompactList& operator=(const CompactList&) = default;
+
+    CompactList(CompactList&& other) noexcept
+        : nodes_(std::move(other.nodes_)), head_(other.head_), tail_(other.tail_),
+          free_(other.free_), size_(other.size_)
+    {
+        other.reset_links();
+    }
+
+    CompactList& operator=(CompactList&& other) noexcept{
+        if(this == &other) return *this;
+        nodes_ = std::move(other.nodes_);
+        head_ = other.head_;
+        tail_ = other.tail_;
+        free_ = other.free_;
+        size_ = other.size_;
+        other.reset_links();
+        return *this;
+    }
+
+    bool empty() const noexcept {return size_ == 0;}
+    size_type size() const noexcept {return size_;}
+    // slots in use or on the free chain
+    size_type slots() const noexcept {return nodes_.size();}
+    size_type capacity() const noexcept {return nodes_.capacity();}
+    void reserve(size_type n){
+        assert(n < free_mark_limit && "CompactList is limited to 2^32 - 2 nodes");
+        nodes_.reserve(n);
+    }
+
+    iterator begin() noexcept { return iterator(nodes_.data(), head_); }
+    iterator end() noexcept { return iterator(nodes_.data(), npos); }
+    const_iterator begin() const noexcept { return const_iterator(nodes_.data(), head_); }
+    const_iterator end() const noexcept { return const_iterator(nodes_.data(), npos); }
+
+    // handles of the first and last nodes (npos when empty), and of the
+    // neighbours of node h
+    index_type head() const noexcept {return head_;}
+    index_type tail() const noexcept {return tail_;}
+    index_type next(index_type h) const { return live_node(h).next; }
+    index_type prev(index_type h) const { return live_node(h).prev; }
+
+    T& operator[](index_type h) { return *live_node(h).value(); }
+    const T& operator[](index_type h) const { return *live_node(h).value(); }
+
+    T& front(){
+        assert(size_ > 0 && "front on an empty CompactList");
+        return *nodes_[head_].value();
+    }
+    T& back(){
+        assert(size_ > 0 && "back on an empty CompactList");
+        return *nodes_[tail_].value();
+    }
+
+    index_type push_back(const T& value){ return emplace(npos, value); }
+    index_type push_back(T&& value){ return emplace(npos, std::move(value)); }
+    index_type push_front(const T& value){ return emplace(head_, value); }
+    index_type push_front(T&& value){ return emplace(head_, std::move(value)); }
+
+    template <typename... Args>
+    index_type emplace_back(Args&&... args){ return emplace(npos, std::forward<Args>(args)...); }
+
+    template <typename... Args>
+    index_type emplace_front(Args&&... args){ return emplace(head_, std::forward<Args>(args)...); }
+
+    // Inserts before node pos (at the back if pos is npos) and returns the
+    // new node's handle.
+    template <typename... Args>
+    index_type emplace(index_type pos, Args&&... args){
+        assert((pos == npos || live_node(pos).live()) && "emplace before an erased node");
+        index_type prev = pos == npos ? tail_ : nodes_[pos].prev;
+        index_type h;
+        if(free_ != npos){
+            h = free_;
+            Node& slot = nodes_[h];
+            index_type next_free = slot.next;
+            ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+            slot.prev = prev;
+            slot.next = pos;
+            free_ = next_free;
+        }
+        else{
+            assert(nodes_.size() < free_mark_limit && "CompactList is limited to 2^32 - 2 nodes");
+            h = static_cast<index_type>(nodes_.size());
+            if(nodes_.size() < nodes_.capacity()){
+                nodes_.emplace_back(prev, pos, std::forward<Args>(args)...);
+            }
+            else{
+                // args may refer into the array: build before it moves
+                Node n(prev, pos, std::forward<Args>(args)...);
+                nodes_.emplace_back(std::move(n));
+            }
+        }
+        if(prev == npos) head_ = h;
+        else nodes_[prev].next = h;
+        if(pos == npos) tail_ = h;
+        else nodes_[pos].prev = h;
+        ++size_;
+        return h;
+    }
+
+    void pop_back(){
+        assert(size_ > 0 && "pop_back on an empty CompactList");
+        erase(tail_);
+    }
+
+    void pop_front(){
+        assert(size_ > 0 && "pop_front on an empty CompactList");
+        erase(head_);
+    }
+
+    // Erases node h in O(1) and returns the handle of the node after it.
+    index_type erase(index_type h){
+        Node& n = live_node(h);
+        index_type prev = n.prev, next = n.next;
+        if(prev == npos) head_ = next;
+        else nodes_[prev].next = next;
+        if(next == npos) tail_ = prev;
+        else nodes_[next].prev = prev;
+        n.release(free_);
+        free_ = h;
+        --size_;
+        return next;
+    }
+
+    iterator erase(const_iterator pos){
+        return iterator(nodes_.data(), erase(pos.index_));
+    }
+
+    void clear() noexcept{
+        nodes_.clear();
+        reset_links();
+    }
+
+    // Moves the nodes into a fresh array in list order, with no free slots
+    // and no spare capacity, so a walk reads memory front to back. Old
+    // handles are invalid afterwards; the i-th node has handle i.
+    void compact(){
+        DynamicArray<Node> packed;
+        packed.reserve(size_);
+        index_type i = 0;
+        for(index_type h = head_; h != npos; h = nodes_[h].next, ++i){
+            index_type next = i + 1 == size_ ? npos : i + 1;
+            packed.emplace_back(i == 0 ? npos : i - 1, next, std::move_if_noexcept(*nodes_[h].value()));
+        }
+        nodes_.swap(packed);
+        head_ = size_ ? 0 : npos;
+        tail_ = size_ ? static_cast<index_type>(size_ - 1) : npos;
+        free_ = npos;
+    }
+
+private:
+    static constexpr size_type free_mark_limit = compact_detail::free_mark;
+
+    Node& live_node(index_type h){
+        assert(h < nodes_.size() && nodes_[h].live() && "handle of an erased node");
+        return nodes_[h];
+    }
+    const Node& live_node(index_type h) const{
+        assert(h < nodes_.size() && nodes_[h].live() && "handle of an erased node");
+        return nodes_[h];
+    }
+
+    void reset_links() noexcept{
+        head_ = tail_ = free_ = npos;
+        size_ = 0;
+    }
+
+    DynamicArray<Node> nodes_;
+    index_type head_;
+    index_type tail_;
+    index_type free_;               // first slot of the free chain
+    size_type size_;
+};
+
+#endif /* COMPACT_LIST_HPP */
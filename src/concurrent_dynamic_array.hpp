@@ -0,0 +1,185 @@
+#ifndef CONCURRENT_DYNAMIC_ARRAY_HPP
+#define CONCURRENT_DYNAMIC_ARRAY_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Append-only array that many threads can push_back into at once, without a
+// lock, while others read. Elements live in segments that double in size
+// (16, 32, 64, ... elements) and are never moved or freed before the array
+// is destroyed, so references and pointers to elements stay valid. The
+// appender that claims the middle slot of a segment allocates the next one,
+// so an append rarely finds its segment missing, and none waits for another
+// thread's allocation.
+//
+//     ConcurrentDynamicArray<Result> results;
+//     // any number of threads:
+//     std::size_t i = results.push_back(r);     // slot claimed by fetch_add
+//     const Result& mine = results[i];          // stable address
+//
+// push_back returns the index of the new element. Reading results[i] is
+// wait-free and valid once the push that returned i has completed in a
+// thread the reader synchronizes with (join, a release/acquire flag, ...),
+// or after is_ready(i) returned true. size() counts claimed slots, which may
+// include elements still being constructed by another thread.
+//
+// If an element constructor throws, its slot stays claimed but never
+// becomes ready; it is skipped on destruction.
+template <typename T>
+class ConcurrentDynamicArray{
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    static constexpr size_type first_segment_size = 16;
+
+    ConcurrentDynamicArray() noexcept
+        :size_(0)
+    {
+        for(auto& s : segments_) s.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ConcurrentDynamicArray(const ConcurrentDynamicArray&) = delete;
+    ConcurrentDynamicArray& operator=(const ConcurrentDynamicArray&) = delete;
+
+    // must not run concurrently with any other member
+    ~ConcurrentDynamicArray(){
+        size_type n = size_.load(std::memory_order_acquire);
+        for(size_type k = 0; k < max_segments; ++k){
+            unsigned char* seg = segments_[k].load(std::memory_order_acquire);
+            if(!seg) continue;
+            size_type len = segment_size(k);
+            size_type base = segment_base(k);
+            for(size_type j = 0; j < len && base + j < n; ++j){
+                if(flags(seg, k)[j].load(std::memory_order_acquire)) elements(seg)[j].~T();
+            }
+            free_segment(seg, k);
+        }
+    }
+
+    size_type push_back(const T& value){
+        return emplace_back(value);
+    }
+
+    size_type push_back(T&& value){
+        return emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    size_type emplace_back(Args&&... args){
+        size_type index = size_.fetch_add(1, std::memory_order_relaxed);
+        assert(index < max_size() && "ConcurrentDynamicArray is full");
+        size_type k = segment_of(index);
+        unsigned char* seg = segment(k);
+        size_type j = index - segment_base(k);
+        ::new (static_cast<void*>(elements(seg) + j)) T(std::forward<Args>(args)...);
+        flags(seg, k)[j].store(1, std::memory_order_release);
+        if(j == segment_size(k) / 2 && k + 1 < max_segments){
+            // exactly one appender claims the middle slot: it allocates the
+            // next segment while half of this one is still free, so racing
+            // allocations (and their discarded copies) stay rare. Our element
+            // is in already; on failure a later appender allocates on demand.
+            try{
+                segment(k + 1);
+            }
+            catch(const std::bad_alloc&){}
+        }
+        return index;
+    }
+
+    // Allocates the segments covering the first n slots up front, so later
+    // appends below n never allocate. Safe to call concurrently with pushes.
+    void reserve(size_type n){
+        assert(n <= max_size());
+        for(size_type k = 0; k < max_segments && segment_base(k) < n; ++k) segment(k);
+    }
+
+    T& operator[](size_type index){
+        assert(index < size() && "index out of bound");
+        size_type k = segment_of(index);
+        return elements(segments_[k].load(std::memory_order_acquire))[index - segment_base(k)];
+    }
+
+    const T& operator[](size_type index) const {
+        assert(index < size() && "index out of bound");
+        size_type k = segment_of(index);
+        return elements(segments_[k].load(std::memory_order_acquire))[index - segment_base(k)];
+    }
+
+    // true once the element at index is constructed and visible to this thread
+    bool is_ready(size_type index) const noexcept{
+        if(index >= size()) return false;
+        size_type k = segment_of(index);
+        unsigned char* seg = segments_[k].load(std::memory_order_acquire);
+        return seg && flags(seg, k)[index - segment_base(k)].load(std::memory_order_acquire);
+    }
+
+    size_type size() const noexcept { return size_.load(std::memory_order_acquire); }
+    bool empty() const noexcept { return size() == 0; }
+
+    static constexpr size_type max_size() noexcept { return segment_base(max_segments); }
+
+private:
+    static constexpr size_type first_bits = 4;                  // log2(first_segment_size)
+    static constexpr size_type max_segments = 48 - first_bits;  // 2^48 slots is plenty
+    static_assert(first_segment_size == size_type(1) << first_bits, "first_bits out of sync");
+
+    static constexpr std::align_val_t segment_align{alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+                                                    ? alignof(T) : __STDCPP_DEFAULT_NEW_ALIGNMENT__};
+
+    std::atomic<size_type> size_;
+    std::atomic<unsigned char*> segments_[max_segments];
+
+    // segment k holds slots [16 * (2^k - 1), 16 * (2^(k+1) - 1))
+    static constexpr size_type segment_size(size_type k) noexcept { return first_segment_size << k; }
+    static constexpr size_type segment_base(size_type k) noexcept { return first_segment_size * ((size_type(1) << k) - 1); }
+
+    static size_type segment_of(size_type index) noexcept{
+        return floor_log2(index + first_segment_size) - first_bits;
+    }
+
+    static size_type floor_log2(size_type x) noexcept{
+#if defined(__GNUC__)
+        return sizeof(unsigned long long) * 8 - 1 - static_cast<size_type>(__builtin_clzll(x));
+#else
+        size_type r = 0;
+        while(x >>= 1) ++r;
+        return r;
+#endif
+    }
+
+    // segment layout: [ T elements ][ one ready flag per element ]
+    static size_type flags_offset(size_type k) noexcept { return segment_size(k) * sizeof(T); }
+    static size_type segment_bytes(size_type k) noexcept { return flags_offset(k) + segment_size(k); }
+
+    static T* elements(unsigned char* seg) noexcept { return reinterpret_cast<T*>(seg); }
+    static std::atomic<unsigned char>* flags(unsigned char* seg, size_type k) noexcept{
+        return reinterpret_cast<std::atomic<unsigned char>*>(seg + flags_offset(k));
+    }
+
+    static void free_segment(unsigned char* seg, size_type k) noexcept{
+        ::operator delete(seg, segment_bytes(k), segment_align);
+    }
+
+    // Returns segment k, allocating it if needed. Normally emplace_back has
+    // allocated it ahead already; threads that still race all try to publish
+    // with a CAS, and the losers free their copy and use the winner's. No
+    // thread ever waits for another.
+    unsigned char* segment(size_type k){
+        unsigned char* seg = segments_[k].load(std::memory_order_acquire);
+        if(seg) return seg;
+        unsigned char* fresh = static_cast<unsigned char*>(::operator new(segment_bytes(k), segment_align));
+        std::atomic<unsigned char>* f = flags(fresh, k);
+        for(size_type j = 0; j < segment_size(k); ++j) ::new (static_cast<void*>(f + j)) std::atomic<unsigned char>(0);
+        if(segments_[k].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel, std::memory_order_acquire)){
+            return fresh;
+        }
+        free_segment(fresh, k);
+        return seg;
+    }
+};
+
+#endif /* CONCURRENT_DYNAMIC_ARRAY_HPP */
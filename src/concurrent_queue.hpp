@@ -0,0 +1,196 @@
+#ifndef CONCURRENT_QUEUE_HPP
+#define CONCURRENT_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "hazard_pointer.hpp"
+
+// Lock-free FIFO queue (Michael-Scott) for any number of producer and
+// consumer threads. The list always starts with a dummy node: enqueue links a
+// node after the last one with a CAS on its next pointer and then swings the
+// tail; try_dequeue swings the head to the first real node, which becomes the
+// new dummy, and takes its value. A thread that finds the tail lagging behind
+// advances it before retrying, so no operation waits on another.
+// Unlinked dummies are reclaimed through hazard pointers (no use-after-free,
+// no ABA).
+//
+// try_dequeue_bulk claims up to n elements with a single CAS on the head,
+// which is where consumers contend.
+//
+//     ConcurrentQueue<Job> jobs;
+//     jobs.enqueue(j);                               // producers
+//     Job batch[32];
+//     std::size_t k = jobs.try_dequeue_bulk(batch, 32);   // consumers
+//
+// T's move assignment must not throw: a dequeued element is already
+// unlinked when it is moved out, so there is no way to put it back. The
+// same goes for storing into try_dequeue_bulk's output iterator.
+template <typename T>
+class ConcurrentQueue{
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+                  "ConcurrentQueue needs a nothrow move assignment to dequeue");
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    ConcurrentQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    // must not run concurrently with any other member
+    ~ConcurrentQueue(){
+        Node* n = head_.load(std::memory_order_relaxed);
+        Node* next = n->next.load(std::memory_order_relaxed);
+        delete n;                                  // the dummy holds no value
+        while(next){
+            n = next;
+            next = n->next.load(std::memory_order_relaxed);
+            n->value()->~T();
+            delete n;
+        }
+    }
+
+    void enqueue(const T& value){
+        emplace(value);
+    }
+
+    void enqueue(T&& value){
+        emplace(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args){
+        Node* n = new Node();
+        try{
+            ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...);
+        }
+        catch(...){
+            delete n;
+            throw;
+        }
+        hazard::Guard guard;
+        for(;;){
+            Node* t = guard.protect(tail_);
+            Node* next = t->next.load(std::memory_order_acquire);
+            if(next){
+                // the tail lags behind: help it along, then retry
+                tail_.compare_exchange_weak(t, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if(t->next.compare_exchange_weak(next, n, std::memory_order_release, std::memory_order_relaxed)){
+                // may fail if another thread already helped; either way it moved
+                tail_.compare_exchange_strong(t, n, std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    // Moves the oldest element into out and returns true, or returns false
+    // if the queue was empty.
+    bool try_dequeue(T& out){
+        hazard::Guard head_guard, next_guard;
+        for(;;){
+            Node* h = head_guard.protect(head_);
+            Node* next = h->next.load(std::memory_order_acquire);
+            if(!next) return false;
+            // next cannot be retired before the head moves past h, so it is
+            // safe once published while the head is still h
+            next_guard.set(next);
+            if(head_.load(std::memory_order_acquire) != h) continue;
+            if(!advance_tail_past(h)) continue;
+            if(head_.compare_exchange_strong(h, next, std::memory_order_acq_rel, std::memory_order_relaxed)){
+                take(next, out);
+                head_guard.reset();
+                hazard::retire(h);
+                return true;
+            }
+        }
+    }
+
+    // Moves up to max of the oldest elements, in order, to *out++ and
+    // returns how many: one CAS on the head for the whole batch.
+    template <typename OutputIt>
+    size_type try_dequeue_bulk(OutputIt out, size_type max){
+        if(max == 0) return 0;
+        hazard::Guard head_guard, walk_guard, next_guard;
+        for(;;){
+            Node* h = head_guard.protect(head_);
+            // walk up to max nodes past h hand over hand; while the head is
+            // still h none of them can have been retired
+            Node* last = h;
+            size_type k = 0;
+            bool stale = false;
+            while(k < max){
+                Node* next = last->next.load(std::memory_order_acquire);
+                if(!next) break;
+                next_guard.set(next);
+                if(head_.load(std::memory_order_acquire) != h){ stale = true; break; }
+                if(!advance_tail_past(last)){ stale = true; break; }
+                walk_guard.set(next);               // keep next protected as last
+                last = next;
+                ++k;
+            }
+            if(stale) continue;
+            if(k == 0) return 0;
+            if(head_.compare_exchange_strong(h, last, std::memory_order_acq_rel, std::memory_order_relaxed)){
+                // h..last are ours now: take the values of the k nodes after h
+                // and retire every node before the new dummy
+                Node* n = h;
+                for(size_type i = 0; i < k; ++i){
+                    Node* next = n->next.load(std::memory_order_relaxed);
+                    take(next, *out);
+                    ++out;
+                    if(n == h) head_guard.reset();
+                    hazard::retire(n);
+                    n = next;
+                }
+                return k;
+            }
+        }
+    }
+
+    // A snapshot: may be stale by the time the caller looks at it.
+    bool empty() const{
+        hazard::Guard guard;
+        Node* h = guard.protect(head_);
+        return h->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node{
+        std::atomic<Node*> next;
+        alignas(T) unsigned char storage[sizeof(T)];   // empty in the dummy
+
+        Node() noexcept : next(nullptr) {}
+        T* value() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    // The head must never pass the tail, or the tail would point at a
+    // retired node. Returns true once the tail is known to be past n, false
+    // if n is the tail and has no successor.
+    bool advance_tail_past(Node* n) noexcept{
+        Node* t = tail_.load(std::memory_order_acquire);
+        if(t != n) return true;
+        Node* next = n->next.load(std::memory_order_acquire);
+        if(!next) return false;
+        tail_.compare_exchange_strong(t, next, std::memory_order_release, std::memory_order_relaxed);
+        return true;
+    }
+
+    // moves the value out of n (which then becomes the dummy) into out
+    template <typename Out>
+    static void take(Node* n, Out&& out){
+        std::forward<Out>(out) = std::move(*n->value());
+        n->value()->~T();
+    }
+
+    // head_ and tail_ are written by different sides: keep them apart
+    alignas(64) std::atomic<Node*> head_;
+    alignas(64) std::atomic<Node*> tail_;
+};
+
+#endif /* CONCURRENT_QUEUE_HPP */
@@ -0,0 +1,440 @@
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <utility>
+#include "skip_list.hpp"
+
+// Skip list ordered set or map for many threads and read-mostly workloads
+// (the lazy skip list of Herlihy, Lev, Luchangco and Shavit).
+//  - find and contains take no lock and never retry: they walk the links
+//    and check two flags on the node they land on.
+//  - insert and erase lock only the predecessors they relink, plus the
+//    victim, with a spinlock per node, then check that nothing moved before
+//    writing. Each thread allocates nodes from pools of its own, so writers
+//    to different parts of the list do not meet.
+//  - insert looks the key up before building a node, so inserting a key
+//    that is present allocates nothing; emplace has to build the value
+//    first to learn its key.
+//  - erase first marks the node (logically deleted: readers skip it), then
+//    unlinks it.
+//
+// Erased nodes are not freed while other threads may still be walking
+// through them: they are kept until reclaim() or the destructor, both of
+// which must not run concurrently with anything else. That keeps readers
+// free of hazard-pointer traffic and suits read-mostly use; a workload that
+// erases a lot should call reclaim() at quiet points.
+//
+//     ConcurrentSkipListMap<std::uint64_t, Session> sessions;
+//     sessions.insert({id, s});                     // any thread
+//     if(const auto* e = sessions.find(id)) use(e->second);
+//
+// Values are immutable once inserted; a pointer from find stays valid until
+// reclaim() or destruction, even if its element is erased meanwhile.
+// Iteration is weakly consistent: it sees every element present for the
+// whole walk and may or may not see concurrent changes.
+template <typename Value, typename Key, typename KeyOf, typename Compare = std::less<Key>>
+class ConcurrentSkipList{
+    struct ThreadPools;
+
+    struct Node{
+        alignas(Value) unsigned char storage[sizeof(Value)];
+        unsigned height;
+        ThreadPools* pools;                 // of the thread that allocated it
+        std::atomic<bool> locked;           // held by writers relinking after it
+        std::atomic<bool> marked;           // logically deleted
+        std::atomic<bool> fully_linked;     // linked on every level
+        Node* retired_next;                 // retired list, once erased
+
+        Node(unsigned h, ThreadPools* p) noexcept
+            : height(h), pools(p), locked(false), marked(false), fully_linked(false), retired_next(nullptr) {}
+
+        const Value* value() const noexcept { return std::launder(reinterpret_cast<const Value*>(storage)); }
+        std::atomic<Node*>* links() noexcept{
+            return reinterpret_cast<std::atomic<Node*>*>(reinterpret_cast<unsigned char*>(this) + links_offset);
+        }
+
+        void lock() noexcept{
+            while(locked.exchange(true, std::memory_order_acquire)){
+                while(locked.load(std::memory_order_relaxed)) std::this_thread::yield();
+            }
+        }
+        void unlock() noexcept { locked.store(false, std::memory_order_release); }
+    };
+
+    using Link = std::atomic<Node*>;
+    static constexpr unsigned max_height = skip_detail::max_height;
+    static constexpr std::size_t links_offset = alloc_detail::align_up(sizeof(Node), alignof(Link));
+    static constexpr std::size_t node_align = alignof(Node) > alignof(Link) ? alignof(Node) : alignof(Link);
+
+public:
+    using key_type    = Key;
+    using value_type  = Value;
+    using size_type   = std::size_t;
+    using key_compare = Compare;
+
+class const_iterator{
+    friend class ConcurrentSkipList;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Value;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Value*;
+    using reference         = const Value&;
+
+    const_iterator() noexcept : node_(nullptr) {}
+
+    reference operator*()  const { return *node_->value(); }
+    pointer   operator->() const { return node_->value(); }
+
+    const_iterator& operator++(){
+        node_ = live_from(node_->links()[0].load(std::memory_order_acquire));
+        return *this;
+    }
+    const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+
+    bool operator==(const const_iterator& other) const { return node_ == other.node_; }
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+private:
+    explicit const_iterator(Node* node) noexcept : node_(node) {}
+    Node* node_;
+};
+
+    explicit ConcurrentSkipList(const Compare& comp = Compare())
+        : id_(new_id()), thread_pools_(nullptr), comp_(comp), head_(allocate_node(max_height)),
+          size_(0), retired_(nullptr) {}
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    // must not run concurrently with any other member
+    ~ConcurrentSkipList(){
+        Node* n = head_->links()[0].load(std::memory_order_relaxed);
+        while(n){
+            Node* next = n->links()[0].load(std::memory_order_relaxed);
+            destroy_node(n);
+            n = next;
+        }
+        free_node(head_);
+        reclaim();
+        ThreadPools* p = thread_pools_.load(std::memory_order_relaxed);
+        while(p){
+            ThreadPools* next = p->next;
+            delete p;
+            p = next;
+        }
+    }
+
+    // Relaxed count: exact only when no writer is running.
+    size_type size() const noexcept { return size_.load(std::memory_order_relaxed); }
+    bool empty() const noexcept { return size() == 0; }
+
+    const_iterator begin() const noexcept { return const_iterator(live_from(head_->links()[0].load(std::memory_order_acquire))); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+    // first live element not less than key
+    const_iterator lower_bound(const Key& key) const{
+        Node* preds[max_height];
+        Node* succs[max_height];
+        search(key, preds, succs);
+        return const_iterator(live_from(succs[0]));
+    }
+
+    // The element with key, or nullptr.
+    const Value* find(const Key& key) const{
+        Node* preds[max_height];
+        Node* succs[max_height];
+        int level = search(key, preds, succs);
+        if(level < 0) return nullptr;
+        Node* n = succs[level];
+        return n->fully_linked.load(std::memory_order_acquire) && !n->marked.load(std::memory_order_acquire)
+            ? n->value() : nullptr;
+    }
+
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    // Inserts value unless its key is present; returns whether it did.
+    bool insert(const Value& value){ return insert_value(value); }
+    bool insert(Value&& value){ return insert_value(std::move(value)); }
+
+    // Builds the value first, then drops it if its key is present.
+    template <typename... Args>
+    bool emplace(Args&&... args){
+        Node* n = create_node(next_height(), std::forward<Args>(args)...);
+        Node* preds[max_height];
+        Node* succs[max_height];
+        int level = search(KeyOf()(*n->value()), preds, succs);
+        return link(n, preds, succs, level);
+    }
+
+    // Returns whether key was present and this call erased it.
+    bool erase(const Key& key){
+        Node* preds[max_height];
+        Node* succs[max_height];
+        Node* victim = nullptr;
+        for(;;){
+            int level = search(key, preds, succs);
+            if(!victim){
+                if(level < 0) return false;
+                Node* n = succs[level];
+                // only a fully linked node found at its own top level can be
+                // erased; otherwise it is still being inserted
+                if(!n->fully_linked.load(std::memory_order_acquire) || n->height != unsigned(level) + 1 ||
+                   n->marked.load(std::memory_order_acquire)){
+                    return false;
+                }
+                n->lock();
+                if(n->marked.load(std::memory_order_relaxed)){
+                    n->unlock();
+                    return false;
+                }
+                n->marked.store(true, std::memory_order_release);
+                victim = n;
+            }
+            for(unsigned l = 0; l < victim->height; ++l) succs[l] = victim;
+            unsigned locked = 0;
+            bool valid = lock_preds(victim->height, preds, succs, true, locked);
+            if(valid){
+                for(unsigned l = victim->height; l-- > 0;){
+                    preds[l]->links()[l].store(victim->links()[l].load(std::memory_order_relaxed),
+                                               std::memory_order_release);
+                }
+                victim->unlock();
+            }
+            unlock_preds(preds, locked);
+            if(valid){
+                retire(victim);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    // Frees the nodes erased so far. Must not run concurrently with any
+    // other member; pointers from find to erased elements die here.
+    void reclaim() noexcept{
+        Node* n = retired_.exchange(nullptr, std::memory_order_acquire);
+        while(n){
+            Node* next = n->retired_next;
+            destroy_node(n);
+            n = next;
+        }
+    }
+
+private:
+    // Node memory for one thread. Only that thread allocates from it, and
+    // frees into it while other threads run; reclaim() and the destructor
+    // free any node into its owner's pools, as they run alone.
+    struct alignas(64) ThreadPools{
+        explicit ThreadPools(std::thread::id t) noexcept : owner(t), next(nullptr) {}
+        std::thread::id owner;
+        skip_detail::HeightPools pools;
+        ThreadPools* next;                  // in thread_pools_
+    };
+
+    // looks the key up first: a present key costs no allocation
+    template <typename V>
+    bool insert_value(V&& value){
+        Node* preds[max_height];
+        Node* succs[max_height];
+        int level;
+        while((level = search(KeyOf()(value), preds, succs)) >= 0){
+            if(settled_present(succs[level])) return false;
+        }
+        Node* n = create_node(next_height(), std::forward<V>(value));
+        return link(n, preds, succs, level);
+    }
+
+    // Links n in unless its key turns out to be present, in which case n is
+    // freed. level and preds/succs come from a search for n's key.
+    bool link(Node* n, Node** preds, Node** succs, int level){
+        const Key& key = KeyOf()(*n->value());
+        for(;;){
+            if(level >= 0){
+                if(settled_present(succs[level])){
+                    destroy_node(n);
+                    return false;
+                }
+            }
+            else{
+                unsigned locked = 0;
+                bool valid = lock_preds(n->height, preds, succs, false, locked);
+                if(valid){
+                    for(unsigned l = 0; l < n->height; ++l) n->links()[l].store(succs[l], std::memory_order_relaxed);
+                    for(unsigned l = 0; l < n->height; ++l) preds[l]->links()[l].store(n, std::memory_order_release);
+                    n->fully_linked.store(true, std::memory_order_release);
+                }
+                unlock_preds(preds, locked);
+                if(valid){
+                    size_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            level = search(key, preds, succs);
+        }
+    }
+
+    // Whether a node found by search holds its key for good: false means it
+    // is being erased and the caller should search again. A concurrent
+    // insert of the same key may still be linking it; wait for that.
+    static bool settled_present(Node* found) noexcept{
+        if(found->marked.load(std::memory_order_acquire)) return false;
+        while(!found->fully_linked.load(std::memory_order_acquire)) std::this_thread::yield();
+        return true;
+    }
+
+    // skips nodes that are erased or still being linked
+    static Node* live_from(Node* n) noexcept{
+        while(n && (n->marked.load(std::memory_order_acquire) || !n->fully_linked.load(std::memory_order_acquire))){
+            n = n->links()[0].load(std::memory_order_acquire);
+        }
+        return n;
+    }
+
+    // Fills preds[l]/succs[l] with the nodes around key on every level and
+    // returns the highest level whose successor has key, or -1.
+    int search(const Key& key, Node** preds, Node** succs) const{
+        int found = -1;
+        Node* pred = head_;
+        for(unsigned l = max_height; l-- > 0;){
+            Node* curr = pred->links()[l].load(std::memory_order_acquire);
+            while(curr && comp_(KeyOf()(*curr->value()), key)){
+                pred = curr;
+                curr = curr->links()[l].load(std::memory_order_acquire);
+            }
+            if(found < 0 && curr && !comp_(key, KeyOf()(*curr->value()))) found = int(l);
+            preds[l] = pred;
+            succs[l] = curr;
+        }
+        return found;
+    }
+
+    // Locks the distinct predecessors on levels [0, height) bottom up and
+    // checks that each is live and still links to succs[l], which must be
+    // live too unless it is the victim of an erase. locked receives how
+    // many levels to unlock.
+    bool lock_preds(unsigned height, Node** preds, Node** succs, bool erasing, unsigned& locked) noexcept{
+        for(unsigned l = 0; l < height; ++l){
+            Node* pred = preds[l];
+            if(l == 0 || pred != preds[l - 1]) pred->lock();
+            locked = l + 1;
+            Node* succ = succs[l];
+            if(pred->marked.load(std::memory_order_acquire)) return false;
+            if(!erasing && succ && succ->marked.load(std::memory_order_acquire)) return false;
+            if(pred->links()[l].load(std::memory_order_acquire) != succ) return false;
+        }
+        return true;
+    }
+
+    void unlock_preds(Node** preds, unsigned locked) noexcept{
+        for(unsigned l = 0; l < locked; ++l){
+            if(l == 0 || preds[l] != preds[l - 1]) preds[l]->unlock();
+        }
+    }
+
+    void retire(Node* n) noexcept{
+        Node* old = retired_.load(std::memory_order_relaxed);
+        do{
+            n->retired_next = old;
+        }while(!retired_.compare_exchange_weak(old, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    static unsigned next_height() noexcept{
+        thread_local skip_detail::HeightGenerator rng(
+            0x9E3779B97F4A7C15ull ^ std::hash<std::thread::id>()(std::this_thread::get_id()));
+        return rng.next();
+    }
+
+    static std::size_t node_bytes(unsigned height) noexcept{
+        return links_offset + height * sizeof(Link);
+    }
+
+    // Unique per list and never reused, so a thread's cached pools cannot
+    // outlive their list unnoticed.
+    static std::uint64_t new_id() noexcept{
+        static std::atomic<std::uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // This thread's pools for this list. A one-entry thread-local cache makes
+    // the common case a compare; otherwise the registry is searched, and a
+    // thread's first node adds its entry there with a CAS.
+    ThreadPools* local_pools(){
+        struct Cache{ std::uint64_t list = 0; ThreadPools* pools = nullptr; };
+        thread_local Cache cache;
+        if(cache.list == id_) return cache.pools;
+        std::thread::id me = std::this_thread::get_id();
+        ThreadPools* head = thread_pools_.load(std::memory_order_acquire);
+        ThreadPools* p = head;
+        while(p && p->owner != me) p = p->next;
+        if(!p){
+            // a thread id is reused only once its thread has exited, so no
+            // other live thread can add an entry for me meanwhile
+            p = new ThreadPools(me);
+            p->next = head;
+            while(!thread_pools_.compare_exchange_weak(p->next, p, std::memory_order_release,
+                                                       std::memory_order_relaxed)){}
+        }
+        cache.list = id_;
+        cache.pools = p;
+        return p;
+    }
+
+    Node* allocate_node(unsigned height){
+        ThreadPools* tp = local_pools();
+        void* p = tp->pools.allocate(height, node_bytes(height), node_align);
+        Node* n = ::new (p) Node(height, tp);
+        for(unsigned l = 0; l < height; ++l) ::new (static_cast<void*>(n->links() + l)) Link(nullptr);
+        return n;
+    }
+
+    template <typename... Args>
+    Node* create_node(unsigned height, Args&&... args){
+        Node* n = allocate_node(height);
+        try{
+            ::new (static_cast<void*>(n->storage)) Value(std::forward<Args>(args)...);
+        }
+        catch(...){
+            free_node(n);
+            throw;
+        }
+        return n;
+    }
+
+    void destroy_node(Node* n) noexcept{
+        n->value()->~Value();
+        free_node(n);
+    }
+
+    // Runs concurrently only on a node the calling thread allocated.
+    void free_node(Node* n) noexcept{
+        unsigned height = n->height;
+        ThreadPools* tp = n->pools;
+        for(unsigned l = 0; l < height; ++l) n->links()[l].~Link();
+        n->~Node();
+        tp->pools.deallocate(n, height, node_bytes(height), node_align);
+    }
+
+    const std::uint64_t id_;
+    std::atomic<ThreadPools*> thread_pools_;    // one entry per thread that allocated
+    Compare comp_;
+    Node* head_;                        // max_height links, no value
+    alignas(64) std::atomic<size_type> size_;
+    std::atomic<Node*> retired_;
+};
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using ConcurrentSkipListMap = ConcurrentSkipList<std::pair<const Key, T>, Key, skip_detail::First, Compare>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using ConcurrentSkipListSet = ConcurrentSkipList<Key, Key, skip_detail::Identity, Compare>;
+
+#endif /* CONCURRENT_SKIP_LIST_HPP */
@@ -0,0 +1,115 @@
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "hazard_pointer.hpp"
+
+// Lock-free LIFO stack (Treiber stack) for any number of pushing and popping
+// threads. push links a new node in with a CAS on the head; try_pop unlinks
+// the head with a CAS. Popped nodes are reclaimed through hazard pointers, so
+// a node another thread is still reading is never freed, and a head that was
+// popped and pushed again in between cannot fool a CAS (no ABA).
+// Failed CASes back off exponentially to ease contention on the head.
+//
+//     ConcurrentStack<Task> work;
+//     work.push(t);                 // any thread
+//     Task next;
+//     if (work.try_pop(next)) run(next);
+//
+// T's move assignment must not throw: try_pop moves the value out only
+// after the node is unlinked, when there is no way to put it back.
+template <typename T>
+class ConcurrentStack{
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+                  "ConcurrentStack needs a nothrow move assignment to pop");
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    ConcurrentStack() noexcept : head_(nullptr) {}
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // must not run concurrently with any other member
+    ~ConcurrentStack(){
+        Node* n = head_.load(std::memory_order_relaxed);
+        while(n){
+            Node* next = n->next;
+            delete n;
+            n = next;
+        }
+    }
+
+    void push(const T& value){
+        emplace(value);
+    }
+
+    void push(T&& value){
+        emplace(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args){
+        Node* n = new Node(std::forward<Args>(args)...);
+        n->next = head_.load(std::memory_order_relaxed);
+        Backoff backoff;
+        while(!head_.compare_exchange_weak(n->next, n, std::memory_order_release, std::memory_order_relaxed)){
+            backoff.pause();
+        }
+    }
+
+    // Moves the top element into out and returns true, or returns false if
+    // the stack was empty.
+    bool try_pop(T& out){
+        hazard::Guard guard;
+        Backoff backoff;
+        for(;;){
+            Node* h = guard.protect(head_);
+            if(!h) return false;
+            // h is protected, so reading h->next is safe even if h was popped
+            // meanwhile; the CAS below then fails
+            Node* next = h->next;
+            if(head_.compare_exchange_strong(h, next, std::memory_order_acquire, std::memory_order_relaxed)){
+                out = std::move(h->value);
+                guard.reset();
+                hazard::retire(h);
+                return true;
+            }
+            backoff.pause();
+        }
+    }
+
+    // A snapshot: may be stale by the time the caller looks at it.
+    bool empty() const noexcept { return head_.load(std::memory_order_acquire) == nullptr; }
+
+private:
+    struct Node{
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+        T value;
+        Node* next;
+    };
+
+    // spins 1, 2, 4, ... 64 rounds between attempts, then yields
+    struct Backoff{
+        unsigned rounds = 1;
+        void pause() noexcept{
+            if(rounds <= 64){
+                for(unsigned i = 0; i < rounds; ++i) std::atomic_signal_fence(std::memory_order_seq_cst);
+                rounds *= 2;
+            }
+            else{
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::atomic<Node*> head_;
+};
+
+#endif /* CONCURRENT_STACK_HPP */
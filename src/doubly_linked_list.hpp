@@ -3,12 +3,15 @@
 
 #include <cstddef>
 #include <cassert>
+#include <memory>
 #include <utility>
 
-template<typename T>
+// Nodes come from Allocator rebound to Node; see LinkedList for pooling them.
+template<typename T, typename Allocator = std::allocator<T>>
 class DoublyLinkedList{
     using size_type = std::size_t;
 public:
+    using allocator_type = Allocator;
     struct Node{
         T data;
         Node* next;
@@ -18,50 +21,41 @@ public:
     };
 
     DoublyLinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+    explicit DoublyLinkedList(const Allocator& alloc) : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
     ~DoublyLinkedList() {clear();}
 
     bool empty() const noexcept {return size_ == 0;}
     size_type size() const noexcept {return size_;}
     Node* head() noexcept {return head_;}
     Node* tail() noexcept {return tail_;}
+    const Node* head() const noexcept {return head_;}
+    const Node* tail() const noexcept {return tail_;}
+    allocator_type get_allocator() const noexcept {return allocator_type(alloc_);}
 
     DoublyLinkedList(const DoublyLinkedList&) = delete;
     DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
 
-    void push_back(const T& value){
-        Node* temp = new Node(value);
-        temp -> prev = tail_;
-        if(tail_) tail_ -> next = temp;
-        tail_ = temp;
-        if(!head_) head_ = temp;
+    void push_back(const T& value){ emplace_back(value); }
+    void push_back(T&& value){ emplace_back(std::move(value)); }
+    void push_front(const T& value){ emplace_front(value); }
+    void push_front(T&& value){ emplace_front(std::move(value)); }
+
+    // The emplace functions return the new node: a handle that stays valid
+    // until the node is erased, for the O(1) node operations below.
+    template<typename... Args>
+    Node* emplace_back(Args&&... args){
+        Node* temp = create_node(std::forward<Args>(args)...);
+        link_before(nullptr, temp);
         ++size_;
+        return temp;
     }
 
-    void push_back(T&& value){
-        Node* temp = new Node(std::move(value));
-        temp -> prev = tail_;
-        if(tail_) tail_ -> next = temp;
-        tail_ = temp;
-        if(!head_) head_ = temp;
-        ++size_;
-    }
-
-    void push_front(const T& value){
-        Node* temp = new Node(value);
-        temp -> next = head_;
-        if(head_) head_ -> prev = temp;
-        head_ = temp;
-        if(!tail_) tail_ = temp;
-        ++size_;
-    }
-
-    void push_front(T&& value){
-        Node* temp = new Node(std::move(value));
-        temp -> next = head_;
-        if(head_) head_ -> prev = temp;
-        head_ = temp;
-        if(!tail_) tail_ = temp;
+    template<typename... Args>
+    Node* emplace_front(Args&&... args){
+        Node* temp = create_node(std::forward<Args>(args)...);
+        link_before(head_, temp);
         ++size_;
+        return temp;
     }
 
     void pop_back(){
@@ -70,7 +64,7 @@ public:
         tail_ = tail_ -> prev;
         if(tail_) tail_ -> next = nullptr;
         else head_ = nullptr;
-        delete temp;
+        destroy_node(temp);
         --size_;
     }
 
@@ -80,7 +74,7 @@ public:
         head_ = head_ -> next;
         if(head_) head_ -> prev = nullptr;
         else tail_ = nullptr;
-        delete temp;
+        destroy_node(temp);
         --size_;
     }
 
@@ -89,7 +83,7 @@ public:
         while(cur){
             Node* temp = cur;
             cur = cur -> next;
-            delete temp;
+            destroy_node(temp);
         }
         head_ = tail_ = nullptr;
         size_ = 0;
@@ -110,14 +104,87 @@ public:
         Node* next_node       = cur -> next;
         previous_node -> next = next_node;
         next_node -> prev     = previous_node;
-        delete cur;
+        destroy_node(cur);
         --size_;
     }
+    // Erases node n of this list. O(1).
+    void erase(Node* n) noexcept{
+        assert(n && size_ > 0 && "erase of a null node");
+        unlink(n);
+        destroy_node(n);
+        --size_;
+    }
+
+    // Relinks node n of this list in at the front. O(1).
+    void move_to_front(Node* n) noexcept{
+        if(n == head_) return;
+        unlink(n);
+        link_before(head_, n);
+    }
+
+    // Relinks node n of this list in at the back. O(1).
+    void move_to_back(Node* n) noexcept{
+        if(n == tail_) return;
+        unlink(n);
+        link_before(nullptr, n);
+    }
+
+    // Moves node n out of other and links it in before pos (at the back if
+    // pos is null). No element is copied; other must use an equal allocator.
+    void splice(Node* pos, DoublyLinkedList& other, Node* n) noexcept{
+        assert(alloc_ == other.alloc_ && "splice of DoublyLinkedLists with unequal allocators");
+        if(pos == n) return;
+        other.unlink(n);
+        --other.size_;
+        link_before(pos, n);
+        ++size_;
+    }
+
 private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits    = std::allocator_traits<node_allocator>;
 
+    node_allocator alloc_;
     Node* head_;
     Node* tail_;
     size_type size_;
+
+    template <typename... Args>
+    Node* create_node(Args&&... args){
+        Node* n = node_traits::allocate(alloc_, 1);
+        try{
+            node_traits::construct(alloc_, n, std::forward<Args>(args)...);
+        }
+        catch(...){
+            node_traits::deallocate(alloc_, n, 1);
+            throw;
+        }
+        return n;
+    }
+
+    void destroy_node(Node* n) noexcept{
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    // links the detached node n in before pos (at the back if pos is null)
+    void link_before(Node* pos, Node* n) noexcept{
+        n -> next = pos;
+        n -> prev = pos ? pos -> prev : tail_;
+        if(n -> prev) n -> prev -> next = n;
+        else head_ = n;
+        if(pos) pos -> prev = n;
+        else tail_ = n;
+    }
+
+    // detaches n, leaving size_ alone
+    void unlink(Node* n) noexcept{
+        if(n -> prev) n -> prev -> next = n -> next;
+        else head_ = n -> next;
+        if(n -> next) n -> next -> prev = n -> prev;
+        else tail_ = n -> prev;
+        n -> next = n -> prev = nullptr;
+    }
 };
 
 #endif /*DOUBLY LINKED LIST HPP*/
@@ -6,53 +6,73 @@
 #include <cassert>
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <utility>
+#include <iterator>
+#include <type_traits>
+#include "relocation.hpp"
+#include "growth_policy.hpp"
 
-template <typename T> 
+template <typename T, typename Allocator = std::allocator<T>, typename Policy = DefaultGrowthPolicy>
 class DynamicArray{
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "Allocator::value_type must be T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "DynamicArray requires an allocator with raw T* pointers");
 public:
-    using value_type = T;
-    using size_type  = std::size_t;
+    using value_type     = T;
+    using allocator_type = Allocator;
+    using growth_policy  = Policy;
+    using size_type      = std::size_t;
     DynamicArray()
         :data_(nullptr), size_(0), capacity_(0) {}                     //Default Constructor    
+
+    explicit DynamicArray(const Allocator& alloc) noexcept
+        :alloc_(alloc), data_(nullptr), size_(0), capacity_(0) {}
     
-    explicit DynamicArray(size_type n)
-        :data_(nullptr), size_(0), capacity_(0)
+    explicit DynamicArray(size_type n, const Allocator& alloc = Allocator())
+        :alloc_(alloc), data_(nullptr), size_(0), capacity_(0)
     {
         if(n) reserve(n);
         for(size_type i=0; i < n; i++){
-            alloc_.construct(data_+i, T());
+            alloc_traits::construct(alloc_, data_+i, T());
         }
         size_ = n;
     }
 
-    explicit DynamicArray(size_type n, const T& value) 
-        :data_(nullptr), size_(0), capacity_(0)
+    explicit DynamicArray(size_type n, const T& value, const Allocator& alloc = Allocator()) 
+        :alloc_(alloc), data_(nullptr), size_(0), capacity_(0)
         {
             if(n) reserve(n);
             for(size_type i=0; i < n; i++){
-                alloc_.construct(data_+i, value);
+                alloc_traits::construct(alloc_, data_+i, value);
             }
             size_ = n;
         }
 
     //copy ctor
-    DynamicArray(const DynamicArray<T>& other)
-        :data_(nullptr), size_(0), capacity_(0)
+    DynamicArray(const DynamicArray& other)
+        :DynamicArray(other, alloc_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+    //copy ctor with an explicit allocator
+    DynamicArray(const DynamicArray& other, const Allocator& alloc)
+        :alloc_(alloc), data_(nullptr), size_(0), capacity_(0)
     {   
         if(other.size_){
-           T* new_data = alloc_.allocate(other.size_);
+           T* new_data = alloc_traits::allocate(alloc_, other.size_);
            size_type i = 0;
            try{
                 for(;i < other.size_; i++){
-                    alloc_.construct(new_data + i, other[i]);
+                    alloc_traits::construct(alloc_, new_data + i, other[i]);
                 }
            }
            catch(...){
                 for(size_type j = 0; j < i; j++){
-                    alloc_.destroy(new_data + j);
+                    alloc_traits::destroy(alloc_, new_data + j);
                 }
-                alloc_.deallocate(new_data, other.size_);
+                alloc_traits::deallocate(alloc_, new_data, other.size_);
+                throw;
            }
            data_ = new_data;
            size_ = other.size_;
@@ -61,7 +81,7 @@ public:
     }
 
     //move ctor
-    DynamicArray(DynamicArray<T>&& other) noexcept
+    DynamicArray(DynamicArray&& other) noexcept
         :alloc_(std::move(other.alloc_)), data_(other.data_), size_(other.size_), capacity_(other.capacity_)
     {
         other.data_ = nullptr;
@@ -70,92 +90,133 @@ public:
     }
     
     ~DynamicArray(){
-        //destruct constructed elements
-        for(size_type i=0; i < size_; i++){
-            alloc_.destroy(data_ + i);
-        }
-        //deallocate any extra reserved data
-        if(data_) alloc_.deallocate(data_, capacity_);
-        //assigning default values back
-        data_ = nullptr;
-        size_ = 0;
-        capacity_ = 0;
+        release_storage();
     }
 
     //Assignment (copy)
-     DynamicArray& operator=(const DynamicArray<T>& other){
+     DynamicArray& operator=(const DynamicArray& other){
         if(this == &other) return *this;
-        DynamicArray<T> temp(other);
-        swap(temp);
+        // the copy is built with the allocator this array must end up with
+        constexpr bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+        DynamicArray temp(other, propagate ? other.alloc_ : alloc_);
+        swap_all(temp);
         return *this;
      }
 
      //Assignment Move
-    DynamicArray& operator=(DynamicArray<T>&& other) noexcept{
+    DynamicArray& operator=(DynamicArray&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                 alloc_traits::is_always_equal::value)
+    {
         if(this == &other) return *this;
-        if(data_){
-            for(size_type i = 0; i < size_; i++){
-                alloc_.destroy(data_+i);
+        if(alloc_traits::propagate_on_container_move_assignment::value || alloc_ == other.alloc_){
+            release_storage();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+                alloc_ = std::move(other.alloc_);
             }
-            alloc_.deallocate(data_, capacity_);
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+        else{
+            // unequal allocators that do not propagate: our allocator cannot free
+            // other's buffer, so the elements are moved one by one
+            DynamicArray temp(alloc_);
+            temp.reserve(other.size_);
+            for(size_type i = 0; i < other.size_; ++i){
+                temp.emplace_back(std::move_if_noexcept(other.data_[i]));
+            }
+            swap_all(temp);
+            other.clear();
         }
-        alloc_ = std::move(other.alloc_);
-        data_ = other.data_;
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-        other.data_ = nullptr;
-        other.size_ = 0;
-        other.capacity_ = 0;
         return *this;
     }     
 
-    void swap(DynamicArray<T>& other) noexcept{
+    // Allocators are exchanged only when the allocator asks for it
+    // (propagate_on_container_swap); otherwise they must compare equal.
+    void swap(DynamicArray& other) noexcept{
         using std::swap;
-        swap(alloc_, other.alloc_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value){
+            swap(alloc_, other.alloc_);
+        }
+        else{
+            assert(alloc_ == other.alloc_ && "swap of DynamicArrays with unequal allocators");
+        }
         swap(data_, other.data_);
         swap(size_, other.size_);
         swap(capacity_, other.capacity_);
     }
+
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
     void reserve(size_type new_cap) {
         if (new_cap <= capacity_) return;
-         T* new_data = alloc_.allocate(new_cap);
-        // move/construct existing elements
-        size_type i = 0;
-        try{
-            for (; i < size_; ++i) {
-            alloc_.construct(new_data + i, std::move_if_noexcept(data_[i]));
-            }
-        }
-        catch(...){
-            for(size_type j = 0; j < i; ++j) alloc_.destroy(new_data + j);
-            alloc_.deallocate(new_data, new_cap);
-            throw;
-        }
-
-        for(size_type j=0; j < size_; j++) alloc_.destroy(data_+j);  
-        if (data_) alloc_.deallocate(data_, capacity_);
-        data_ = new_data;
-        capacity_ = new_cap;
+        reallocate(new_cap);
     }
 
     void resize(size_type new_size){
         if(size_ > new_size){
             for(size_type i = new_size; i < size_; i++) {
-                alloc_.destroy(data_ + i);
+                alloc_traits::destroy(alloc_, data_ + i);
             }
             size_ = new_size;
             maybe_shrink();
         }
 
         if(new_size > capacity_){
-            reserve(std::max(new_size, capacity_*2));
+            reserve(std::max(new_size, Policy::grow(capacity_)));
         }
 
         for(size_type i = size_; i < new_size; i++){
-            alloc_.construct(data_+i, T());
+            alloc_traits::construct(alloc_, data_+i, T());
+        }
+        size_ = new_size;
+    }
+
+    // Like resize, but new elements are default-initialized: for trivial T
+    // their bytes are left indeterminate, ready to be overwritten (read(),
+    // recv(), memcpy) without paying for zeroing first.
+    void resize_for_overwrite(size_type new_size){
+        static_assert(std::is_trivially_default_constructible<T>::value &&
+                      std::is_trivially_destructible<T>::value,
+                      "resize_for_overwrite requires a trivial element type");
+        if(new_size > capacity_){
+            reserve(std::max(new_size, Policy::grow(capacity_)));
         }
         size_ = new_size;
+        maybe_shrink();
+    }
+
+    // Zero-copy ingestion: makes room for at least min_spare more elements
+    // (growing by the policy) and returns the uninitialized tail
+    // [data() + size(), data() + capacity()). Fill a prefix of it directly,
+    // then publish it with commit_append.
+    //
+    //     char* p = buf.spare_capacity(64 * 1024);
+    //     ssize_t n = ::read(fd, p, buf.spare_size());
+    //     if (n > 0) buf.commit_append(n);
+    T* spare_capacity(size_type min_spare = 0){
+        if(capacity_ - size_ < min_spare){
+            reserve(std::max(size_ + min_spare, Policy::grow(capacity_)));
+        }
+        return data_ + size_;
+    }
+
+    size_type spare_size() const noexcept{
+        return capacity_ - size_;
+    }
+
+    // Appends the first n spare slots as elements. The caller must have
+    // constructed them there (for trivially copyable T, writing the bytes is
+    // enough).
+    void commit_append(size_type n) noexcept{
+        assert(n <= capacity_ - size_ && "commit_append past capacity");
+        size_ += n;
     }
+
     size_type size() const noexcept{
         return size_;
     }
@@ -171,104 +232,89 @@ public:
     //push back lvalue
     void push_back(const T& value){
         ensure_capacity_for_push();
-        alloc_.construct(data_ + size_, value);
+        alloc_traits::construct(alloc_, data_ + size_, value);
         ++size_;
     }
 
     //push back rvalue
     void push_back(T&& value){
         ensure_capacity_for_push();
-        alloc_.construct(data_ + size_, std::move(value));
+        alloc_traits::construct(alloc_, data_ + size_, std::move(value));
         ++size_;
     }
 
     template <typename... Args>
     void emplace_back(Args&&... args){
         ensure_capacity_for_push();
-        alloc_.construct(data_+size_, std::forward<Args>(args)...);
+        alloc_traits::construct(alloc_, data_+size_, std::forward<Args>(args)...);
         ++size_;
     }
 
     void pop_back(){
         assert(size_ > 0 && "Pop back on empty DynamicArray");
         --size_;
-        alloc_.destroy(data_ + size_);
+        alloc_traits::destroy(alloc_, data_ + size_);
         maybe_shrink();
     }
 
     //lvalue
-  void insert(size_type index, const T& value) {
-    assert(index <= size_);
-    ensure_capacity_for_push();
-    // Case 1: inserting at the end → just push_back
-    if (index == size_) {
-        alloc_.construct(data_ + size_, value);
-        ++size_;
-        return;
-    }
-    // Step 1: construct one new element at the end (raw memory)
-    alloc_.construct(
-        data_ + size_,
-        std::move_if_noexcept(data_[size_ - 1])
-    );
-    // Step 2: shift elements right via move-assignment
-    for (size_type i = size_ - 1; i > index; --i) {
-        data_[i] = std::move_if_noexcept(data_[i - 1]);
-    }
-    // Step 3: assign inserted value
-    data_[index] = value;
-    ++size_;
-   }
-
-   //rvalue
-   void insert(size_type index, T &&value)
-   {
-       assert(index <= size_);
-       ensure_capacity_for_push();
-
-       if (index == size_)
-       {
-           alloc_.construct(data_ + size_, std::move(value));
-           ++size_;
-           return;
-       }
-
-       alloc_.construct(data_ + size_, std::move_if_noexcept(data_[size_ - 1]));
-       for (size_type i = size_ - 1; i > index; --i)
-       {
-           data_[i] = std::move_if_noexcept(data_[i - 1]);
-       }
-       data_[index] = std::move(value);
-       ++size_;
-   }
-
-    // shrink-to-policy: when size_ <= capacity_/4, shrink to max(1, size_*2)
-    void maybe_shrink(){
-        if (capacity_ == 0) return;              // nothing to do
-        if (size_ > capacity_ / 4) return;       // not enough slack to shrink
+    void insert(size_type index, const T& value) {
+        insert_one(index, value);
+    }
 
-        size_type new_cap = size_== 0 ? 1: size_ * 2; 
+    //rvalue
+    void insert(size_type index, T&& value) {
+        insert_one(index, std::move(value));
+    }
 
-        T* new_data = alloc_.allocate(new_cap);
-        size_type i = 0;
-        try{
-            for(; i < size_ ; ++i){
-            alloc_.construct(new_data + i, std::move_if_noexcept(data_[i]));
-            }
+    // Inserts [first, last) before index. The tail is shifted once and the
+    // buffer grows at most once (forward iterators). Strong guarantee for
+    // forward iterators: if T's move may throw, the elements are built into a
+    // fresh buffer even when they would fit. The range must not point into
+    // this array.
+    template <typename InputIt,
+              typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert(size_type index, InputIt first, InputIt last){
+        assert(index <= size_);
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value){
+            insert_range(index, first, last, static_cast<size_type>(std::distance(first, last)));
         }
-        catch(...){
-            for(size_type j = 0; j < i; ++j){
-                alloc_.destroy(new_data + j);
-            }
-            alloc_.deallocate(new_data, new_cap);
-            throw;
+        else{
+            // single-pass input: stage the elements first so we know the count
+            DynamicArray staged(alloc_);
+            for(; first != last; ++first) staged.emplace_back(*first);
+            insert_range(index, std::make_move_iterator(staged.begin()),
+                         std::make_move_iterator(staged.end()), staged.size());
         }
+    }
 
-        for(size_type j = 0; j < size_; j++) {alloc_.destroy(data_ + j);}
-        if(data_) alloc_.deallocate(data_, capacity_);
+    template <typename InputIt,
+              typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void append(InputIt first, InputIt last){
+        insert(size_, first, last);
+    }
 
-        data_ = new_data;
-        capacity_ = new_cap;
+    // shrink-to-policy: by default, when size_ <= capacity_/4, shrink to max(1, size_*2)
+    void maybe_shrink(){
+        if (!Policy::should_shrink(size_, capacity_)) return;   // disabled or not enough slack
+
+        size_type new_cap = Policy::shrink_target(size_);
+        if (new_cap >= capacity_) return;
+        reallocate(new_cap);
+    }
+
+    // Drops all spare capacity regardless of the policy.
+    // An empty array gives its buffer back entirely (capacity 0, data nullptr).
+    void shrink_to_fit(){
+        if (size_ == capacity_) return;
+        if (size_ == 0){
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+            data_ = nullptr;
+            capacity_ = 0;
+            return;
+        }
+        reallocate(size_);
     }
 
     T& operator[](size_type index){
@@ -282,25 +328,71 @@ public:
     }       
 
     void erase(size_type index){
-        assert(index < size_  && index >= 0 && "Index out of bound");
-        
-       // shift everything left
-        for (size_type i = index; i + 1 < size_; ++i) {
-            alloc_.destroy(data_ + i);
-            alloc_.construct(data_ + i, std::move_if_noexcept(data_[i + 1]));
-        }
-
-        // destroy old last element
-        alloc_.destroy(data_ + (size_ - 1));
-
+        assert(index < size_ && "Index out of bound");
+        // close the gap (memmove for trivially relocatable T)
+        relocation::erase_n(alloc_, data_, index, size_, 1);
         --size_;
         maybe_shrink();
     }
    
+    // Removes [first, last): one shift of the tail, at most one shrink.
+    void erase(const T* first, const T* last){
+        assert(data_ <= first && first <= last && last <= data_ + size_ && "Range out of bound");
+        size_type index = static_cast<size_type>(first - data_);
+        size_type count = static_cast<size_type>(last - first);
+        if (count == 0) return;
+
+        relocation::erase_n(alloc_, data_, index, size_, count);
+        size_ -= count;
+        maybe_shrink();
+    }
+
+    // Removes every element matching pred in a single compaction pass and
+    // returns how many were removed. Shrinks at most once, at the end.
+    template <typename Pred>
+    size_type erase_if(Pred pred){
+        size_type kept = 0;
+        size_type i = 0;
+        if constexpr (is_nothrow_relocatable_v<T>){
+            try{
+                for(; i < size_; ++i){
+                    if(pred(data_[i])){
+                        alloc_traits::destroy(alloc_, data_ + i);
+                    }
+                    else{
+                        if(kept != i) relocation::relocate_n(alloc_, data_ + i, 1, data_ + kept);
+                        ++kept;
+                    }
+                }
+            }
+            catch(...){
+                // close the hole between the kept prefix and the unvisited tail
+                relocation::shift_left(alloc_, data_, kept, size_, i - kept);
+                size_ -= i - kept;
+                throw;
+            }
+        }
+        else{
+            // moves may throw: compact by assignment so no slot is ever raw,
+            // and destroy the leftovers only once the pass is through
+            for(; i < size_; ++i){
+                if(!pred(data_[i])){
+                    if(kept != i) data_[kept] = std::move(data_[i]);
+                    ++kept;
+                }
+            }
+            for(size_type j = kept; j < size_; ++j) alloc_traits::destroy(alloc_, data_ + j);
+        }
+        size_type removed = size_ - kept;
+        size_ = kept;
+        if (removed) maybe_shrink();
+        return removed;
+    }
+
     void clear(){
         for (size_type i = 0; i < size_; ++i)
         {
-           alloc_.destroy(data_+i);
+           alloc_traits::destroy(alloc_, data_+i);
         }
         size_ = 0;
     }
@@ -313,19 +405,138 @@ public:
     const T* data() const noexcept { return data_; }
     
 private:
-    std::allocator<T> alloc_;
+    Allocator alloc_;
     T* data_;
     size_type size_;
     size_type capacity_;
     
-    void ensure_capacity_for_push(){
-        if(capacity_ == 0){
-            reserve(1);
+    void swap_all(DynamicArray& other) noexcept{
+        using std::swap;
+        swap(alloc_, other.alloc_);
+        swap(data_, other.data_);
+        swap(size_, other.size_);
+        swap(capacity_, other.capacity_);
+    }
+
+    // Destroys the elements and returns the buffer to the allocator.
+    void release_storage() noexcept{
+        for(size_type i=0; i < size_; i++){
+            alloc_traits::destroy(alloc_, data_ + i);
+        }
+        if(data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+    }
+
+    // Moves the elements into a fresh buffer of new_cap slots (new_cap >= size_).
+    // Strong guarantee: on exception the array is left unchanged.
+    void reallocate(size_type new_cap){
+        if constexpr (relocation::allocator_can_reallocate<Allocator, T>::value){
+            // resize in place where the allocator can (realloc / mremap)
+            if (data_){
+                data_ = alloc_.reallocate(data_, capacity_, new_cap);
+                capacity_ = new_cap;
+                return;
+            }
+        }
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        try{
+            relocation::relocate_n(alloc_, data_, size_, new_data);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        if (data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_cap;
+    }
+
+    template <typename U>
+    void insert_one(size_type index, U&& value){
+        assert(index <= size_);
+        if (size_ && !std::less<const T*>()(&value, data_) && std::less<const T*>()(&value, data_ + size_)){
+            // value is one of our elements: growing or shifting would move it first
+            T copy(std::forward<U>(value));
+            insert_one(index, std::move(copy));
             return;
         }
+        ensure_capacity_for_push();
+        if constexpr (is_nothrow_relocatable_v<T>){
+            // open a one-slot gap at index (memmove for trivially relocatable T)
+            relocation::shift_right(alloc_, data_, index, size_, 1);
+            try{
+                alloc_traits::construct(alloc_, data_ + index, std::forward<U>(value));
+            }
+            catch(...){
+                // close the gap again so the array is unchanged
+                relocation::shift_left(alloc_, data_, index, size_ + 1, 1);
+                throw;
+            }
+            ++size_;
+        }
+        else{
+            relocation::insert_by_assignment(alloc_, data_, index, size_, std::forward<U>(value));
+        }
+    }
+
+    template <typename ForwardIt>
+    void insert_range(size_type index, ForwardIt first, ForwardIt last, size_type count){
+        if (count == 0) return;
+        if constexpr (is_nothrow_relocatable_v<T>){
+            if (size_ + count <= capacity_){
+                // in place: open a gap, build the new elements, close it again on failure
+                relocation::shift_right(alloc_, data_, index, size_, count);
+                size_type built = 0;
+                try{
+                    for(; first != last; ++first, ++built){
+                        alloc_traits::construct(alloc_, data_ + index + built, *first);
+                    }
+                }
+                catch(...){
+                    for(size_type j = 0; j < built; ++j) alloc_traits::destroy(alloc_, data_ + index + j);
+                    relocation::shift_left(alloc_, data_, index, size_ + count, count);
+                    throw;
+                }
+                size_ += count;
+                return;
+            }
+        }
+
+        // growing, or a move that may throw: build straight into a new buffer
+        // so the tail moves only once and a failure leaves the array untouched
+        size_type new_cap = size_ + count <= capacity_ ? capacity_
+                                                       : std::max(size_ + count, Policy::grow(capacity_));
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        size_type built = 0;
+        bool prefix_done = false;
+        try{
+            for(; first != last; ++first, ++built){
+                alloc_traits::construct(alloc_, new_data + index + built, *first);
+            }
+            relocation::relocate_prepare_n(alloc_, data_, index, new_data);
+            prefix_done = true;
+            relocation::relocate_prepare_n(alloc_, data_ + index, size_ - index, new_data + index + count);
+        }
+        catch(...){
+            if (prefix_done) relocation::relocate_abort_n(alloc_, new_data, index);
+            for(size_type j = 0; j < built; ++j) alloc_traits::destroy(alloc_, new_data + index + j);
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        relocation::relocate_finish_n(alloc_, data_, size_);
+        if (data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = new_data;
+        size_ += count;
+        capacity_ = new_cap;
+    }
+
+    void ensure_capacity_for_push(){
         if(size_ >= capacity_){
-            //grow policy: capacity *= 2;
-            reserve(capacity_ * 2);
+            //grow policy: capacity *= GrowNum/GrowDen (2 by default); an empty
+            //buffer grows to one slot
+            reserve(Policy::grow(capacity_));
         }
     }
 };
@@ -0,0 +1,45 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+// Compile-time growth/shrink policy for DynamicArray.
+//
+//  - grow:   a full array of capacity c grows to c * GrowNum / GrowDen
+//            (at least c + 1).
+//  - shrink: when AutoShrink is set, pop_back/erase/resize shrink the buffer
+//            once size <= capacity / ShrinkDivisor, down to max(1, size * 2).
+//
+// Shrinking to twice the size while only shrinking at 1/ShrinkDivisor occupancy
+// (ShrinkDivisor > 2) leaves a dead band, so an array oscillating around a
+// boundary does not reallocate on every push/pop.
+template <std::size_t GrowNum, std::size_t GrowDen, std::size_t ShrinkDivisor = 4, bool AutoShrink = true>
+struct GrowthPolicy{
+    static_assert(GrowDen > 0 && GrowNum > GrowDen, "growth factor must be > 1");
+    static_assert(ShrinkDivisor > 2, "shrink threshold must leave hysteresis (ShrinkDivisor > 2)");
+
+    using size_type = std::size_t;
+    static constexpr bool auto_shrink = AutoShrink;
+
+    static constexpr size_type grow(size_type capacity) noexcept{
+        size_type next = capacity / GrowDen * GrowNum + capacity % GrowDen * GrowNum / GrowDen;
+        return next > capacity ? next : capacity + 1;
+    }
+
+    static constexpr bool should_shrink(size_type size, size_type capacity) noexcept{
+        return AutoShrink && capacity != 0 && size <= capacity / ShrinkDivisor;
+    }
+
+    static constexpr size_type shrink_target(size_type size) noexcept{
+        return size == 0 ? 1 : size * 2;
+    }
+};
+
+// capacity *= 2, shrink to size*2 at quarter occupancy (the original behaviour)
+using DefaultGrowthPolicy  = GrowthPolicy<2, 1, 4, true>;
+// capacity *= 1.5: less slack per array, more reallocations while growing
+using CompactGrowthPolicy  = GrowthPolicy<3, 2, 4, true>;
+// capacity *= 2 and never shrinks on its own; use shrink_to_fit() explicitly
+using RetainCapacityPolicy = GrowthPolicy<2, 1, 4, false>;
+
+#endif /* GROWTH_POLICY_HPP */
@@ -0,0 +1,250 @@
+#ifndef HAZARD_POINTER_HPP
+#define HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include "dynamic_array.hpp"
+
+// Hazard pointers: safe memory reclamation for lock-free containers.
+//
+// A thread that is about to dereference a shared node publishes its address
+// in one of its hazard slots (hazard::Guard::protect). A node unlinked from a
+// container is not deleted but retired (hazard::retire); it is freed only
+// once no thread's hazard slot holds it. Because a protected node cannot be
+// freed, its address cannot be reused either, which also rules out ABA on
+// compare-and-swap of protected pointers.
+//
+//     hazard::Guard g;
+//     Node* h = g.protect(head_);                 // h stays valid while g holds it
+//     if (h && head_.compare_exchange_strong(h, h->next)) {
+//         g.reset();
+//         hazard::retire(h);                      // deleted once unprotected
+//     }
+//
+// Each thread owns slots_per_thread slots for its lifetime; retired nodes are
+// scanned in batches once a thread's retire list outgrows the number of
+// hazard slots in use. Nodes still protected when their thread exits are
+// handed to the next thread that scans (or freed at process exit).
+namespace hazard{
+
+    constexpr std::size_t slots_per_thread = 4;
+
+    namespace detail{
+
+        struct Record{
+            std::atomic<void*> slots[slots_per_thread];
+            std::atomic<bool> active;
+            Record* next;
+            unsigned used;                  // bitmask of slots held by Guards, owner thread only
+
+            Record() : active(true), next(nullptr), used(0) {
+                for(auto& s : slots) s.store(nullptr, std::memory_order_relaxed);
+            }
+        };
+
+        struct Retired{
+            void* ptr;
+            void (*deleter)(void*);
+        };
+
+        class Domain{
+        public:
+            Domain() : head_(nullptr), records_(0) {}
+
+            Domain(const Domain&) = delete;
+            Domain& operator=(const Domain&) = delete;
+
+            ~Domain(){
+                // every thread is gone by now: nothing can be protected
+                for(const Retired& r : orphans_) r.deleter(r.ptr);
+                Record* rec = head_.load(std::memory_order_acquire);
+                while(rec){
+                    Record* next = rec->next;
+                    delete rec;
+                    rec = next;
+                }
+            }
+
+            // Claims an inactive record or adds a new one. Records are never freed
+            // before the domain, so the list can be walked without protection.
+            Record* acquire_record(){
+                for(Record* rec = head_.load(std::memory_order_acquire); rec; rec = rec->next){
+                    bool expected = false;
+                    if(!rec->active.load(std::memory_order_relaxed) &&
+                       rec->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)){
+                        return rec;
+                    }
+                }
+                Record* rec = new Record();
+                Record* old = head_.load(std::memory_order_relaxed);
+                do{
+                    rec->next = old;
+                }while(!head_.compare_exchange_weak(old, rec, std::memory_order_acq_rel, std::memory_order_relaxed));
+                records_.fetch_add(1, std::memory_order_relaxed);
+                return rec;
+            }
+
+            void release_record(Record* rec) noexcept{
+                for(auto& s : rec->slots) s.store(nullptr, std::memory_order_release);
+                rec->used = 0;
+                rec->active.store(false, std::memory_order_release);
+            }
+
+            std::size_t hazard_slots() const noexcept{
+                return records_.load(std::memory_order_relaxed) * slots_per_thread;
+            }
+
+            // Frees every node of retired that no hazard slot holds; the rest
+            // stay in retired. Picks up nodes left behind by exited threads.
+            void scan(DynamicArray<Retired>& retired){
+                if(has_orphans_.load(std::memory_order_acquire)){
+                    std::lock_guard<std::mutex> lock(orphan_mutex_);
+                    for(const Retired& r : orphans_) retired.push_back(r);
+                    orphans_.clear();
+                    has_orphans_.store(false, std::memory_order_release);
+                }
+                // pairs with the fence in Guard::protect: a slot published before a
+                // node was unlinked is seen here, or the protector sees the unlink
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                DynamicArray<void*> hazards;
+                for(Record* rec = head_.load(std::memory_order_acquire); rec; rec = rec->next){
+                    for(auto& s : rec->slots){
+                        if(void* p = s.load(std::memory_order_acquire)) hazards.push_back(p);
+                    }
+                }
+                std::sort(hazards.begin(), hazards.end());
+                DynamicArray<Retired> dead;
+                retired.erase_if([&](const Retired& r){
+                    if(std::binary_search(hazards.begin(), hazards.end(), r.ptr)) return false;
+                    dead.push_back(r);
+                    return true;
+                });
+                // deleters run last: they may retire further nodes themselves
+                for(const Retired& r : dead) r.deleter(r.ptr);
+            }
+
+            void adopt(DynamicArray<Retired>& leftovers){
+                if(leftovers.empty()) return;
+                std::lock_guard<std::mutex> lock(orphan_mutex_);
+                for(const Retired& r : leftovers) orphans_.push_back(r);
+                leftovers.clear();
+                has_orphans_.store(true, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<Record*> head_;
+            std::atomic<std::size_t> records_;
+            std::mutex orphan_mutex_;
+            DynamicArray<Retired> orphans_;
+            std::atomic<bool> has_orphans_{false};
+        };
+
+        inline Domain& domain(){
+            static Domain d;
+            return d;
+        }
+
+        // Per-thread record and retire list, set up on first use.
+        struct ThreadState{
+            Record* rec;
+            DynamicArray<Retired> retired;
+
+            ThreadState() : rec(domain().acquire_record()) {}
+
+            ~ThreadState(){
+                domain().release_record(rec);
+                domain().scan(retired);
+                domain().adopt(retired);
+            }
+        };
+
+        // ThreadState's constructor touches domain() first, so the domain is
+        // constructed before, and destroyed after, every thread's state
+        inline ThreadState& thread_state(){
+            thread_local ThreadState state;
+            return state;
+        }
+
+    } // namespace detail
+
+    // Owns one hazard slot of the calling thread for its lifetime.
+    // Not copyable or movable; use it as a local.
+    class Guard{
+    public:
+        Guard(){
+            detail::Record* rec = detail::thread_state().rec;
+            std::size_t i = 0;
+            while(i < slots_per_thread && (rec->used & (1u << i))) ++i;
+            assert(i < slots_per_thread && "too many live hazard::Guards in one thread");
+            rec->used |= 1u << i;
+            slot_ = &rec->slots[i];
+            bit_ = 1u << i;
+            rec_ = rec;
+        }
+
+        ~Guard(){
+            slot_->store(nullptr, std::memory_order_release);
+            rec_->used &= ~bit_;
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // Loads src and publishes the value until it is confirmed stable, so
+        // the returned node cannot be freed while this guard holds it.
+        // Publishing a new pointer also ends the protection of the previous
+        // one: the store is a release, so the reads made through the old
+        // pointer happen before a reclaimer that sees the slot change frees it.
+        template <typename T>
+        T* protect(const std::atomic<T*>& src) noexcept{
+            T* p = src.load(std::memory_order_relaxed);
+            for(;;){
+                slot_->store(p, std::memory_order_release);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                T* again = src.load(std::memory_order_acquire);
+                if(again == p) return p;
+                p = again;
+            }
+        }
+
+        // Publishes p directly; the caller must re-validate that p is still
+        // reachable before dereferencing it.
+        void set(const void* p) noexcept{
+            slot_->store(const_cast<void*>(p), std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void reset() noexcept { slot_->store(nullptr, std::memory_order_release); }
+
+    private:
+        std::atomic<void*>* slot_;
+        unsigned bit_;
+        detail::Record* rec_;
+    };
+
+    // Hands p (already unreachable from the shared structure) to the reclaimer;
+    // deleter(p) runs once no hazard slot holds p.
+    inline void retire(void* p, void (*deleter)(void*)){
+        detail::ThreadState& ts = detail::thread_state();
+        ts.retired.push_back(detail::Retired{p, deleter});
+        std::size_t threshold = 2 * detail::domain().hazard_slots();
+        if(threshold < 64) threshold = 64;
+        if(ts.retired.size() >= threshold) detail::domain().scan(ts.retired);
+    }
+
+    template <typename T>
+    void retire(T* p){
+        retire(static_cast<void*>(p), [](void* q){ delete static_cast<T*>(q); });
+    }
+
+    // Frees whatever the calling thread has retired and nobody protects.
+    inline void collect(){
+        detail::domain().scan(detail::thread_state().retired);
+    }
+
+} // namespace hazard
+
+#endif /* HAZARD_POINTER_HPP */
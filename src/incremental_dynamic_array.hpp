@@ -0,0 +1,278 @@
+#ifndef INCREMENTAL_DYNAMIC_ARRAY_HPP
+#define INCREMENTAL_DYNAMIC_ARRAY_HPP
+
+#include <memory>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "relocation.hpp"
+#include "growth_policy.hpp"
+
+// DynamicArray variant with bounded push_back latency.
+//
+// When a push finds the buffer full it allocates the bigger buffer but moves
+// nothing yet; the new element goes straight into the new buffer. Every later
+// push_back (and pop_back, for nothrow-movable T) then migrates at most
+// MovesPerOp old elements, front to back, until the old buffer is empty and
+// freed. While a migration is running, index i lives in the new buffer if
+// i < migrated() or i is past the old size, and in the old buffer otherwise;
+// operator[] picks the right one with a single compare.
+//
+// With a growth factor of g, a migration of n elements has (g - 1) * n free
+// slots to finish in, so any MovesPerOp >= 1 / (g - 1) keeps migrations from
+// overlapping, and then a push_back or pop_back touches at most
+// MovesPerOp + 1 elements (plus one allocation). A push that does find the
+// previous migration still running finishes it first, touching every
+// element left in the old buffer; so does reserve().
+// Elements are not contiguous while migrating, so there is no data();
+// finish_migration() completes the move on demand. Capacity never shrinks
+// on its own (only Policy::grow is used).
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Policy = DefaultGrowthPolicy, std::size_t MovesPerOp = 4>
+class IncrementalDynamicArray{
+    static_assert(MovesPerOp > 0, "MovesPerOp must be at least 1");
+    using alloc_traits = std::allocator_traits<Allocator>;
+public:
+    using value_type     = T;
+    using allocator_type = Allocator;
+    using size_type      = std::size_t;
+
+    IncrementalDynamicArray()
+        :data_(nullptr), size_(0), capacity_(0), old_(nullptr), old_size_(0), old_capacity_(0), migrated_(0) {}
+
+    explicit IncrementalDynamicArray(const Allocator& alloc) noexcept
+        :alloc_(alloc), data_(nullptr), size_(0), capacity_(0),
+         old_(nullptr), old_size_(0), old_capacity_(0), migrated_(0) {}
+
+    //copy ctor: the copy is built in one contiguous buffer
+    IncrementalDynamicArray(const IncrementalDynamicArray& other)
+        :IncrementalDynamicArray(alloc_traits::select_on_container_copy_construction(other.alloc_))
+    {
+        if(other.size_ == 0) return;
+        data_ = alloc_traits::allocate(alloc_, other.size_);
+        capacity_ = other.size_;
+        try{
+            for(; size_ < other.size_; ++size_) alloc_traits::construct(alloc_, data_ + size_, other[size_]);
+        }
+        catch(...){
+            release_storage();
+            throw;
+        }
+    }
+
+    //move ctor
+    IncrementalDynamicArray(IncrementalDynamicArray&& other) noexcept
+        :IncrementalDynamicArray(std::move(other.alloc_))
+    {
+        swap_state(other);
+    }
+
+    ~IncrementalDynamicArray(){
+        release_storage();
+    }
+
+    IncrementalDynamicArray& operator=(const IncrementalDynamicArray& other){
+        if(this == &other) return *this;
+        IncrementalDynamicArray temp(other);
+        release_storage();
+        swap_state(temp);
+        return *this;
+    }
+
+    // Allocators must compare equal or propagate on move assignment.
+    IncrementalDynamicArray& operator=(IncrementalDynamicArray&& other) noexcept{
+        if(this == &other) return *this;
+        release_storage();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+            alloc_ = std::move(other.alloc_);
+        }
+        else{
+            assert(alloc_ == other.alloc_ && "move assignment with unequal allocators");
+        }
+        swap_state(other);
+        return *this;
+    }
+
+    // Grows to at least new_cap right away (finishing any running
+    // migration); this is the one call that moves everything at once.
+    void reserve(size_type new_cap){
+        if(new_cap <= capacity_) return;
+        finish_migration();
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        try{
+            relocation::relocate_n(alloc_, data_, size_, new_data);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        if(data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_cap;
+    }
+
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    bool is_migrating() const noexcept { return old_ != nullptr; }
+    // elements [0, migrated()) of the old buffer have moved already
+    size_type migrated() const noexcept { return migrated_; }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args){
+        if(size_ == capacity_){
+            // allocate the bigger buffer and build the new element in it; the
+            // old elements stay put and move over during later operations
+            size_type new_cap = Policy::grow(capacity_);
+            T* new_data = alloc_traits::allocate(alloc_, new_cap);
+            try{
+                alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+            }
+            catch(...){
+                alloc_traits::deallocate(alloc_, new_data, new_cap);
+                throw;
+            }
+            // only now finish a migration still running: args may refer to
+            // an element it would move
+            try{
+                finish_migration();
+            }
+            catch(...){
+                alloc_traits::destroy(alloc_, new_data + size_);
+                alloc_traits::deallocate(alloc_, new_data, new_cap);
+                throw;
+            }
+            if(size_ > 0){
+                old_ = data_;
+                old_size_ = size_;
+                old_capacity_ = capacity_;
+                migrated_ = 0;
+            }
+            else if(data_){
+                alloc_traits::deallocate(alloc_, data_, capacity_);
+            }
+            data_ = new_data;
+            capacity_ = new_cap;
+            ++size_;
+            return;
+        }
+        // build first: args may refer to an element that is about to migrate
+        alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+        if(old_){
+            try{
+                migrate_some();
+            }
+            catch(...){
+                --size_;
+                alloc_traits::destroy(alloc_, data_ + size_);
+                throw;
+            }
+        }
+    }
+
+    void pop_back(){
+        assert(size_ > 0 && "Pop back on empty IncrementalDynamicArray");
+        --size_;
+        alloc_traits::destroy(alloc_, slot(size_));
+        if(old_ && size_ < old_size_){
+            // the popped element was the last one still in the old buffer
+            old_size_ = size_;
+            if(migrated_ == old_size_) release_old();
+        }
+        if constexpr (nothrow_migration){
+            if(old_) migrate_some();
+        }
+    }
+
+    void clear() noexcept{
+        for(size_type i = 0; i < size_; ++i) alloc_traits::destroy(alloc_, slot(i));
+        size_ = 0;
+        if(old_) release_old();
+    }
+
+    // Moves every remaining old element now.
+    void finish_migration(){
+        while(old_) migrate_some();
+    }
+
+    T& operator[](size_type index){
+        assert(index < size_ && "index out of bound");
+        return *slot(index);
+    }
+
+    const T& operator[](size_type index) const {
+        assert(index < size_ && "index out of bound");
+        return *slot(index);
+    }
+
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    allocator_type get_allocator() const { return alloc_; }
+
+private:
+    Allocator alloc_;
+    T* data_;                  // current (bigger) buffer
+    size_type size_;
+    size_type capacity_;
+    T* old_;                   // buffer being drained, or nullptr
+    size_type old_size_;       // old_[migrated_, old_size_) still holds elements
+    size_type old_capacity_;
+    size_type migrated_;
+
+    // pop_back only helps migrating when moving an element cannot throw
+    static constexpr bool nothrow_migration =
+        is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible<T>::value;
+
+    T* slot(size_type index) const noexcept{
+        return (index >= migrated_ && index < old_size_) ? old_ + index : data_ + index;
+    }
+
+    // Moves up to MovesPerOp elements from the old buffer. Strong guarantee:
+    // if a move throws, nothing has changed.
+    void migrate_some(){
+        size_type n = old_size_ - migrated_;
+        if(n > MovesPerOp) n = MovesPerOp;
+        relocation::relocate_n(alloc_, old_ + migrated_, n, data_ + migrated_);
+        migrated_ += n;
+        if(migrated_ == old_size_) release_old();
+    }
+
+    void release_old() noexcept{
+        alloc_traits::deallocate(alloc_, old_, old_capacity_);
+        old_ = nullptr;
+        old_size_ = 0;
+        old_capacity_ = 0;
+        migrated_ = 0;
+    }
+
+    void release_storage() noexcept{
+        clear();
+        if(data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = nullptr;
+        capacity_ = 0;
+    }
+
+    void swap_state(IncrementalDynamicArray& other) noexcept{
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(old_, other.old_);
+        std::swap(old_size_, other.old_size_);
+        std::swap(old_capacity_, other.old_capacity_);
+        std::swap(migrated_, other.migrated_);
+    }
+};
+
+#endif /* INCREMENTAL_DYNAMIC_ARRAY_HPP */
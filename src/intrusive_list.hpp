@@ -0,0 +1,411 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Intrusive linked lists: the links live inside the elements, in a hook the
+// element embeds, so the list never allocates and never copies an element.
+// The list links objects the caller owns; an object must stay alive (and in
+// place) while it is linked, and must be unlinked before it is destroyed.
+//
+// A hook is either a base class or a member. An object can sit on several
+// lists at once through several hooks (distinguished by a Tag for bases):
+//
+//     struct Idle;
+//     struct Conn : IntrusiveListHook<Idle> {
+//         IntrusiveListHook<> owner_hook;
+//     };
+//     IntrusiveList<Conn, IntrusiveBaseHook<IntrusiveListHook<Idle>>> idle;
+//     IntrusiveList<Conn, IntrusiveMemberHook<Conn, IntrusiveListHook<>, &Conn::owner_hook>> owned;
+//     idle.push_back(c); owned.push_back(c);
+//     idle.erase(c);                     // O(1), straight from the object
+//
+// Both lists are circular around a sentinel hook stored in the list, so
+// linking and unlinking never branch on the ends. Copying an object copies
+// its hooks as unlinked.
+
+template <typename Tag = void>
+class IntrusiveListHook{
+    template <typename, typename> friend class IntrusiveList;
+public:
+    IntrusiveListHook() noexcept : next_(nullptr), prev_(nullptr) {}
+    IntrusiveListHook(const IntrusiveListHook&) noexcept : next_(nullptr), prev_(nullptr) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+    ~IntrusiveListHook(){ assert(!is_linked() && "object destroyed while still on an IntrusiveList"); }
+
+    bool is_linked() const noexcept { return next_ != nullptr; }
+
+private:
+    IntrusiveListHook* next_;
+    IntrusiveListHook* prev_;
+};
+
+template <typename Tag = void>
+class IntrusiveSListHook{
+    template <typename, typename> friend class IntrusiveSList;
+public:
+    IntrusiveSListHook() noexcept : next_(nullptr) {}
+    IntrusiveSListHook(const IntrusiveSListHook&) noexcept : next_(nullptr) {}
+    IntrusiveSListHook& operator=(const IntrusiveSListHook&) noexcept { return *this; }
+    ~IntrusiveSListHook(){ assert(!is_linked() && "object destroyed while still on an IntrusiveSList"); }
+
+    bool is_linked() const noexcept { return next_ != nullptr; }
+
+private:
+    IntrusiveSListHook* next_;
+};
+
+// The element derives from Hook.
+template <typename Hook>
+struct IntrusiveBaseHook{
+    using hook_type = Hook;
+
+    template <typename T>
+    static Hook* to_hook(T* value) noexcept { return static_cast<Hook*>(value); }
+
+    template <typename T>
+    static T* from_hook(Hook* hook) noexcept { return static_cast<T*>(hook); }
+};
+
+// The element holds a Hook member M.
+template <typename T, typename Hook, Hook T::*M>
+struct IntrusiveMemberHook{
+    using hook_type = Hook;
+
+    template <typename U>
+    static Hook* to_hook(U* value) noexcept { return &(value->*M); }
+
+    template <typename U>
+    static U* from_hook(Hook* hook) noexcept{
+        return reinterpret_cast<U*>(reinterpret_cast<char*>(hook) - offset());
+    }
+
+private:
+    // offset of M within T, worked out on raw storage (no T is constructed)
+    static std::ptrdiff_t offset() noexcept{
+        alignas(T) static unsigned char probe[sizeof(T)];
+        T* t = reinterpret_cast<T*>(probe);
+        return reinterpret_cast<char*>(&(t->*M)) - reinterpret_cast<char*>(t);
+    }
+};
+
+// Doubly linked intrusive list: O(1) push/pop at both ends, insert before any
+// position, and erase of any linked object.
+template <typename T, typename Access = IntrusiveBaseHook<IntrusiveListHook<>>>
+class IntrusiveList{
+    using Hook = typename Access::hook_type;
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <bool Const>
+    class basic_iterator{
+        friend class IntrusiveList;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept : hook_(nullptr) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& it) noexcept : hook_(it.hook_) {}
+
+        reference operator*()  const { return *Access::template from_hook<T>(hook_); }
+        pointer   operator->() const { return Access::template from_hook<T>(hook_); }
+
+        basic_iterator& operator++() { hook_ = hook_->next_; return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++(*this); return tmp; }
+        basic_iterator& operator--() { hook_ = hook_->prev_; return *this; }
+        basic_iterator operator--(int) { basic_iterator tmp = *this; --(*this); return tmp; }
+
+        bool operator==(const basic_iterator& other) const { return hook_ == other.hook_; }
+        bool operator!=(const basic_iterator& other) const { return hook_ != other.hook_; }
+
+    private:
+        friend class basic_iterator<!Const>;
+        explicit basic_iterator(Hook* h) noexcept : hook_(h) {}
+        Hook* hook_;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    IntrusiveList() noexcept : size_(0) { root_.next_ = root_.prev_ = &root_; }
+
+    // unlinks every element; the elements themselves are untouched
+    ~IntrusiveList(){ clear(); }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() { take(other); }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept{
+        if(this != &other){
+            clear();
+            take(other);
+        }
+        return *this;
+    }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    T& front(){
+        assert(size_ != 0 && "front() on empty list");
+        return *Access::template from_hook<T>(root_.next_);
+    }
+    T& back(){
+        assert(size_ != 0 && "back() on empty list");
+        return *Access::template from_hook<T>(root_.prev_);
+    }
+
+    iterator begin() noexcept { return iterator(root_.next_); }
+    iterator end() noexcept { return iterator(&root_); }
+    const_iterator begin() const noexcept { return const_iterator(root_.next_); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<Hook*>(static_cast<const Hook*>(&root_))); }
+
+    // iterator to a linked object, without searching
+    iterator iterator_to(T& value) noexcept{
+        Hook* h = Access::template to_hook<T>(&value);
+        assert(h->is_linked() && "iterator_to() of an unlinked object");
+        return iterator(h);
+    }
+
+    void push_front(T& value) noexcept { link_before(root_.next_, value); }
+    void push_back(T& value) noexcept { link_before(&root_, value); }
+
+    // links value in before pos and returns an iterator to it
+    iterator insert(const_iterator pos, T& value) noexcept{
+        return iterator(link_before(pos.hook_, value));
+    }
+
+    void pop_front() noexcept{
+        assert(size_ != 0 && "pop_front() on empty list");
+        unlink(root_.next_);
+    }
+
+    void pop_back() noexcept{
+        assert(size_ != 0 && "pop_back() on empty list");
+        unlink(root_.prev_);
+    }
+
+    // Unlinks value, which must be on this list. O(1).
+    void erase(T& value) noexcept{
+        unlink(Access::template to_hook<T>(&value));
+    }
+
+    iterator erase(const_iterator pos) noexcept{
+        assert(pos.hook_ != &root_ && "erase() at end()");
+        Hook* next = pos.hook_->next_;
+        unlink(pos.hook_);
+        return iterator(next);
+    }
+
+    void clear() noexcept{
+        Hook* h = root_.next_;
+        while(h != &root_){
+            Hook* next = h->next_;
+            h->next_ = h->prev_ = nullptr;
+            h = next;
+        }
+        root_.next_ = root_.prev_ = &root_;
+        size_ = 0;
+    }
+
+private:
+    struct Root : Hook{
+        // the sentinel is never an element: it must not trip the hook's
+        // linked-on-destruction check
+        ~Root(){ this->next_ = this->prev_ = nullptr; }
+    };
+    Root root_;
+    size_type size_;
+
+    Hook* link_before(Hook* pos, T& value) noexcept{
+        Hook* h = Access::template to_hook<T>(&value);
+        assert(!h->is_linked() && "object is already on a list through this hook");
+        h->next_ = pos;
+        h->prev_ = pos->prev_;
+        pos->prev_->next_ = h;
+        pos->prev_ = h;
+        ++size_;
+        return h;
+    }
+
+    void unlink(Hook* h) noexcept{
+        assert(h->is_linked() && "erase() of an unlinked object");
+        h->prev_->next_ = h->next_;
+        h->next_->prev_ = h->prev_;
+        h->next_ = h->prev_ = nullptr;
+        --size_;
+    }
+
+    void take(IntrusiveList& other) noexcept{
+        if(other.empty()) return;
+        root_.next_ = other.root_.next_;
+        root_.prev_ = other.root_.prev_;
+        root_.next_->prev_ = &root_;
+        root_.prev_->next_ = &root_;
+        size_ = other.size_;
+        other.root_.next_ = other.root_.prev_ = &other.root_;
+        other.size_ = 0;
+    }
+};
+
+// Singly linked intrusive list: one pointer per hook. O(1) push at both
+// ends, pop at the front and erase after a position; erase(value) has to
+// find the predecessor and is O(n).
+template <typename T, typename Access = IntrusiveBaseHook<IntrusiveSListHook<>>>
+class IntrusiveSList{
+    using Hook = typename Access::hook_type;
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    template <bool Const>
+    class basic_iterator{
+        friend class IntrusiveSList;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept : hook_(nullptr) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& it) noexcept : hook_(it.hook_) {}
+
+        reference operator*()  const { return *Access::template from_hook<T>(hook_); }
+        pointer   operator->() const { return Access::template from_hook<T>(hook_); }
+
+        basic_iterator& operator++() { hook_ = hook_->next_; return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const basic_iterator& other) const { return hook_ == other.hook_; }
+        bool operator!=(const basic_iterator& other) const { return hook_ != other.hook_; }
+
+    private:
+        friend class basic_iterator<!Const>;
+        explicit basic_iterator(Hook* h) noexcept : hook_(h) {}
+        Hook* hook_;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    IntrusiveSList() noexcept : last_(&root_), size_(0) { root_.next_ = &root_; }
+    ~IntrusiveSList(){ clear(); }
+
+    IntrusiveSList(const IntrusiveSList&) = delete;
+    IntrusiveSList& operator=(const IntrusiveSList&) = delete;
+
+    IntrusiveSList(IntrusiveSList&& other) noexcept : IntrusiveSList() { take(other); }
+
+    IntrusiveSList& operator=(IntrusiveSList&& other) noexcept{
+        if(this != &other){
+            clear();
+            take(other);
+        }
+        return *this;
+    }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    T& front(){
+        assert(size_ != 0 && "front() on empty list");
+        return *Access::template from_hook<T>(root_.next_);
+    }
+    T& back(){
+        assert(size_ != 0 && "back() on empty list");
+        return *Access::template from_hook<T>(last_);
+    }
+
+    iterator begin() noexcept { return iterator(root_.next_); }
+    iterator end() noexcept { return iterator(&root_); }
+    const_iterator begin() const noexcept { return const_iterator(root_.next_); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<Hook*>(static_cast<const Hook*>(&root_))); }
+    // position before the first element, for insert_after/erase_after
+    iterator before_begin() noexcept { return iterator(&root_); }
+
+    void push_front(T& value) noexcept { insert_after(before_begin(), value); }
+    void push_back(T& value) noexcept { insert_after(iterator(last_), value); }
+
+    iterator insert_after(const_iterator pos, T& value) noexcept{
+        Hook* h = Access::template to_hook<T>(&value);
+        assert(!h->is_linked() && "object is already on a list through this hook");
+        h->next_ = pos.hook_->next_;
+        pos.hook_->next_ = h;
+        if(pos.hook_ == last_) last_ = h;
+        ++size_;
+        return iterator(h);
+    }
+
+    void pop_front() noexcept{
+        assert(size_ != 0 && "pop_front() on empty list");
+        erase_after(before_begin());
+    }
+
+    // unlinks the element after pos and returns an iterator to the one after it
+    iterator erase_after(const_iterator pos) noexcept{
+        Hook* h = pos.hook_->next_;
+        assert(h != &root_ && "erase_after() with nothing after pos");
+        pos.hook_->next_ = h->next_;
+        if(h == last_) last_ = pos.hook_;
+        h->next_ = nullptr;
+        --size_;
+        return iterator(pos.hook_->next_);
+    }
+
+    // Unlinks value, which must be on this list. O(n).
+    void erase(T& value) noexcept{
+        Hook* target = Access::template to_hook<T>(&value);
+        Hook* prev = &root_;
+        while(prev->next_ != target){
+            assert(prev->next_ != &root_ && "erase() of an object not on this list");
+            prev = prev->next_;
+        }
+        erase_after(iterator(prev));
+    }
+
+    void clear() noexcept{
+        Hook* h = root_.next_;
+        while(h != &root_){
+            Hook* next = h->next_;
+            h->next_ = nullptr;
+            h = next;
+        }
+        root_.next_ = &root_;
+        last_ = &root_;
+        size_ = 0;
+    }
+
+private:
+    struct Root : Hook{
+        ~Root(){ this->next_ = nullptr; }
+    };
+    Root root_;
+    Hook* last_;
+    size_type size_;
+
+    void take(IntrusiveSList& other) noexcept{
+        if(other.empty()) return;
+        root_.next_ = other.root_.next_;
+        last_ = other.last_;
+        last_->next_ = &root_;
+        size_ = other.size_;
+        other.root_.next_ = &other.root_;
+        other.last_ = &other.root_;
+        other.size_ = 0;
+    }
+};
+
+#endif /* INTRUSIVE_LIST_HPP */
@@ -7,8 +7,12 @@
 #include <cstddef>
 #include <utility>
 #include <iterator>
+#include <functional>
 
-template <typename T>
+// Singly linked list. Nodes come from Allocator rebound to Node, so a pooled
+// allocator (NodePoolAllocator in allocators.hpp) turns the per-node
+// new/delete into free-list pops and pushes within a few dense slabs.
+template <typename T, typename Allocator = std::allocator<T>>
 class LinkedList{
 public:
 struct Node{
@@ -83,10 +87,15 @@ private:
 };
     
     using size_type = std::size_t;
+    using allocator_type = Allocator;
     LinkedList(): head_{nullptr}, tail_{nullptr}, size_{0}{}
+    explicit LinkedList(const Allocator& alloc): alloc_(alloc), head_{nullptr}, tail_{nullptr}, size_{0}{}
     ~LinkedList(){clear();}
 
-    LinkedList(const LinkedList& other): head_{nullptr}, tail_{nullptr}, size_{0}
+    LinkedList(const LinkedList& other)
+        : LinkedList(other, node_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+    LinkedList(const LinkedList& other, const Allocator& alloc): alloc_(alloc), head_{nullptr}, tail_{nullptr}, size_{0}
     {
         Node* cur = other.head_;
         while(cur){
@@ -96,23 +105,38 @@ private:
     }
 
     LinkedList(LinkedList&& other)
-         noexcept : head_{std::exchange(other.head_, nullptr)}, tail_{std::exchange(other.tail_, nullptr)}, size_{std::exchange(other.size_, 0)}{}
+         noexcept : alloc_(std::move(other.alloc_)), head_{std::exchange(other.head_, nullptr)}, tail_{std::exchange(other.tail_, nullptr)}, size_{std::exchange(other.size_, 0)}{}
 
 
 
     LinkedList& operator=(const LinkedList& other){
         if(this == &other) return *this;
 
-        LinkedList temp(other);
+        // the copy is built with the allocator this list must end up with
+        constexpr bool propagate = node_traits::propagate_on_container_copy_assignment::value;
+        LinkedList temp(other, propagate ? Allocator(other.alloc_) : Allocator(alloc_));
+        if constexpr (propagate) std::swap(alloc_, temp.alloc_);
         std::swap(head_, temp.head_);
         std::swap(tail_, temp.tail_);
         std::swap(size_, temp.size_);   
         return *this; 
     }
 
-    LinkedList& operator=(LinkedList&& other) noexcept{
+    LinkedList& operator=(LinkedList&& other)
+        noexcept(node_traits::propagate_on_container_move_assignment::value ||
+                 node_traits::is_always_equal::value)
+    {
         if(this == &other) return *this;
         clear();
+        if(!node_traits::propagate_on_container_move_assignment::value && !(alloc_ == other.alloc_)){
+            // our allocator cannot free other's nodes: move the elements over
+            for(Node* cur = other.head_; cur; cur = cur -> next) push_back(std::move(cur -> data));
+            other.clear();
+            return *this;
+        }
+        if constexpr (node_traits::propagate_on_container_move_assignment::value){
+            alloc_ = std::move(other.alloc_);
+        }
         
         head_ = other.head_;
         tail_ = other.tail_;
@@ -125,11 +149,13 @@ private:
         return *this;
     }
 
+    allocator_type get_allocator() const noexcept {return allocator_type(alloc_);}
+
     size_t size() const noexcept {return size_;}
     bool empty() const noexcept { return size_ == 0; }
 
     void push_front(const T& value){
-        Node* temp = new Node(value);
+        Node* temp = create_node(value);
         temp -> next = head_;
         head_ = temp;
         if(!tail_) tail_ = head_;
@@ -137,7 +163,7 @@ private:
     }
 
     void push_front(T&& value){
-        Node* temp = new Node(std::move(value));
+        Node* temp = create_node(std::move(value));
         temp -> next = head_;
         head_ = temp;
         if(!tail_) tail_ = head_;
@@ -145,14 +171,14 @@ private:
     }
 
     void push_back(const T& value){
-        Node* temp = new Node(value);
+        Node* temp = create_node(value);
         if(!tail_) {head_ = tail_ = temp;}
         else {tail_ -> next = temp; tail_ = temp;}
         ++size_;
     }
 
     void push_back(T&& value){
-        Node* temp = new Node(std::move(value));
+        Node* temp = create_node(std::move(value));
         if(!tail_) {head_ = tail_ = temp;}
         else {tail_ -> next = temp; tail_ = temp;}
         ++size_;
@@ -162,7 +188,7 @@ private:
         Node* cur = head_;
         while(cur){
             Node* temp = cur -> next;
-            delete cur;
+            destroy_node(cur);
             cur = temp;
         }
         head_ = tail_ = nullptr;
@@ -173,7 +199,7 @@ private:
         assert(size_ != 0 && "pop_front() on empty list");
         Node* temp = head_;
         head_ = head_ -> next;
-        delete temp;
+        destroy_node(temp);
         --size_;
         if(size_ == 0) tail_ = nullptr;
     }
@@ -181,7 +207,7 @@ private:
     void pop_back(){
         assert(size_ != 0 && "pop_back on empty list");
         if(size_ == 1){
-            delete tail_;
+            destroy_node(tail_);
             head_ = tail_ = nullptr;
             size_ = 0;
             return;
@@ -191,7 +217,7 @@ private:
             temp = temp -> next;
         }
         temp -> next = nullptr;
-        delete tail_;
+        destroy_node(tail_);
         tail_ = temp;
         --size_;
     }
@@ -217,7 +243,7 @@ private:
             cur_index++;
         }
 
-        Node* temp = new Node(value);
+        Node* temp = create_node(value);
         temp -> next = cur -> next;
         cur -> next = temp;
         ++size_;
@@ -241,12 +267,191 @@ private:
             cur = cur->next;
         }
 
-        Node* temp = new Node(std::move(value));
+        Node* temp = create_node(std::move(value));
         temp -> next = cur -> next;
         cur -> next = temp;
         ++size_;
     }
 
+    // The algorithms below relink existing nodes; no element is copied, moved
+    // or reallocated, so pointers and references to elements stay valid.
+    // Lists exchanging nodes must use equal allocators.
+
+    // Stable bottom-up merge sort: O(n log n) comparisons, no allocation.
+    // Sorted runs of 1, 2, 4, ... nodes are kept in bins, like binary
+    // counting, so every node is merged O(log n) times.
+    // If comp throws, every element stays in the list, in unspecified order.
+    template <typename Compare = std::less<>>
+    void sort(Compare comp = Compare()){
+        if(size_ < 2) return;
+        // chains[0] is the run being merged, chains[1..64] the bins and
+        // chains[65] the unsorted rest, so a throw can string them together
+        Node* chains[66] = {};
+        Node*& run = chains[0];
+        Node** bins = chains + 1;
+        Node*& cur = chains[65];
+        size_type used = 0;
+        cur = head_;
+        try{
+            while(cur){
+                run = cur;
+                cur = cur -> next;
+                run -> next = nullptr;
+                size_type i = 0;
+                // bins[i] holds earlier elements than run, so it goes first
+                for(; bins[i]; ++i){
+                    Node* earlier = bins[i];
+                    bins[i] = nullptr;
+                    merge_nodes(earlier, run, comp, run);
+                }
+                bins[i] = run;
+                run = nullptr;
+                if(i >= used) used = i + 1;
+            }
+            for(size_type i = 0; i < used; ++i){
+                Node* earlier = bins[i];
+                if(!earlier) continue;
+                bins[i] = nullptr;
+                if(run) merge_nodes(earlier, run, comp, run);
+                else run = earlier;
+            }
+        }
+        catch(...){
+            adopt_chains(chains, 66);
+            throw;
+        }
+        head_ = run;
+        tail_ = run;
+        while(tail_ -> next) tail_ = tail_ -> next;
+    }
+
+    // Merges the sorted list other into this sorted list, leaving other
+    // empty. Stable: of equal elements, those of *this come first. If comp
+    // throws, *this holds the elements of both and other is empty.
+    template <typename Compare = std::less<>>
+    void merge(LinkedList& other, Compare comp = Compare()){
+        if(this == &other || other.empty()) return;
+        assert(alloc_ == other.alloc_ && "merge of LinkedLists with unequal allocators");
+        if(empty()){
+            splice(0, other);
+            return;
+        }
+        // the merged tail is the later of the two tails
+        Node* last = comp(other.tail_ -> data, tail_ -> data) ? tail_ : other.tail_;
+        Node* merged = nullptr;
+        try{
+            merge_nodes(head_, other.head_, comp, merged);
+        }
+        catch(...){
+            // every node of both lists is in merged: keep them all here
+            other.head_ = other.tail_ = nullptr;
+            other.size_ = 0;
+            adopt_chains(&merged, 1);
+            throw;
+        }
+        head_ = merged;
+        tail_ = last;
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    template <typename Compare = std::less<>>
+    void merge(LinkedList&& other, Compare comp = Compare()){
+        merge(other, comp);
+    }
+
+    // Moves all of other's nodes in before position index, leaving other empty.
+    void splice(size_type index, LinkedList& other){
+        assert(index <= size_ && "Index out of bound");
+        if(this == &other || other.empty()) return;
+        assert(alloc_ == other.alloc_ && "splice of LinkedLists with unequal allocators");
+        if(index == 0){
+            other.tail_ -> next = head_;
+            head_ = other.head_;
+            if(!tail_) tail_ = other.tail_;
+        }
+        else if(index == size_){
+            tail_ -> next = other.head_;
+            tail_ = other.tail_;
+        }
+        else{
+            Node* prev = head_;
+            for(size_type i = 0; i < index - 1; ++i) prev = prev -> next;
+            other.tail_ -> next = prev -> next;
+            prev -> next = other.head_;
+        }
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    void splice(size_type index, LinkedList&& other){
+        splice(index, other);
+    }
+
+    void reverse() noexcept{
+        Node* prev = nullptr;
+        Node* cur = head_;
+        tail_ = head_;
+        while(cur){
+            Node* next = cur -> next;
+            cur -> next = prev;
+            prev = cur;
+            cur = next;
+        }
+        head_ = prev;
+    }
+
+    // Erases every element for which pred is true; returns how many.
+    // size_ and tail_ are kept right after each erase, so the list stays
+    // consistent if pred throws part way.
+    template <typename Predicate>
+    size_type remove_if(Predicate pred){
+        size_type removed = 0;
+        Node* prev = nullptr;
+        Node* cur = head_;
+        while(cur){
+            Node* next = cur -> next;
+            if(pred(cur -> data)){
+                if(prev) prev -> next = next;
+                else head_ = next;
+                if(!next) tail_ = prev;
+                destroy_node(cur);
+                --size_;
+                ++removed;
+            }
+            else{
+                prev = cur;
+            }
+            cur = next;
+        }
+        return removed;
+    }
+
+    // Erases every element equal (by eq) to the one before it, keeping the
+    // first of each run; returns how many were erased. Like remove_if, safe
+    // against eq throwing.
+    template <typename BinaryPredicate = std::equal_to<>>
+    size_type unique(BinaryPredicate eq = BinaryPredicate()){
+        if(size_ < 2) return 0;
+        size_type removed = 0;
+        Node* keep = head_;
+        while(Node* cur = keep -> next){
+            if(eq(keep -> data, cur -> data)){
+                keep -> next = cur -> next;
+                if(!keep -> next) tail_ = keep;
+                destroy_node(cur);
+                --size_;
+                ++removed;
+            }
+            else{
+                keep = cur;
+            }
+        }
+        return removed;
+    }
+
   
     iterator begin() {return iterator(head_);}
     iterator end()  {return iterator(nullptr);}
@@ -264,10 +469,82 @@ private:
 
 
 private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits    = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc_;
     Node* head_;
     Node* tail_;
     size_t size_;
 
+    template <typename... Args>
+    Node* create_node(Args&&... args){
+        Node* n = node_traits::allocate(alloc_, 1);
+        try{
+            node_traits::construct(alloc_, n, std::forward<Args>(args)...);
+        }
+        catch(...){
+            node_traits::deallocate(alloc_, n, 1);
+            throw;
+        }
+        return n;
+    }
+
+    void destroy_node(Node* n) noexcept{
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    // Merges two non-empty sorted chains into out; ties take a's node first.
+    // If comp throws, out is still one chain of every node: the merged part,
+    // then the rest of a, then the rest of b.
+    template <typename Compare>
+    static void merge_nodes(Node* a, Node* b, Compare& comp, Node*& out){
+        Node* head = nullptr;
+        Node* last = nullptr;
+        try{
+            while(a && b){
+                Node*& from = comp(b -> data, a -> data) ? b : a;
+                if(last) last -> next = from;
+                else head = from;
+                last = from;
+                from = from -> next;
+            }
+        }
+        catch(...){
+            if(a && b){
+                Node* end = a;
+                while(end -> next) end = end -> next;
+                end -> next = b;
+            }
+            if(last) last -> next = a ? a : b;
+            else head = a ? a : b;
+            out = head;
+            throw;
+        }
+        last -> next = a ? a : b;
+        out = head;
+    }
+
+    // After a comparator threw: strings the null-terminated chains together
+    // as the whole list, recounting size_ and finding tail_.
+    void adopt_chains(Node* const* chains, size_type n) noexcept{
+        head_ = tail_ = nullptr;
+        size_ = 0;
+        for(size_type i = 0; i < n; ++i){
+            Node* c = chains[i];
+            if(!c) continue;
+            if(tail_) tail_ -> next = c;
+            else head_ = c;
+            tail_ = c;
+            ++size_;
+            while(tail_ -> next){
+                tail_ = tail_ -> next;
+                ++size_;
+            }
+        }
+    }
+
 };
 
 #endif /* LINKED_LIST_HPP */
\ No newline at end of file
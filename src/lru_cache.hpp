@@ -0,0 +1,183 @@
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cassert>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include "allocators.hpp"
+#include "doubly_linked_list.hpp"
+
+// Least-recently-used cache with O(1) get, put and erase. The entries live
+// in a DoublyLinkedList ordered from most to least recently used, and a hash
+// index maps each key to its node: a hit relinks the node at the front, and
+// eviction pops from the back. List and index nodes come from two
+// NodePoolAllocator pools, so steady-state churn reuses freed blocks instead
+// of calling new per entry.
+//
+// The capacity counts entries unless a weigher is given, in which case it
+// is a budget for the summed weigher(key, value) of the entries (e.g. bytes).
+//
+//     LRUCache<std::string, Image> cache(64 << 20, [](const std::string&, const Image& i){
+//         return i.bytes();
+//     });
+//     cache.set_eviction_callback([](const std::string& k, Image& i){ spill(k, i); });
+//     cache.put(path, load(path));
+//     if(Image* i = cache.get(path)) draw(*i);
+//
+// Pointers returned by get/peek stay valid until the entry is erased or
+// evicted. K must be copyable: the list and the index each hold a copy.
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LRUCache{
+public:
+    using key_type    = K;
+    using mapped_type = V;
+    using size_type   = std::size_t;
+    using Weigher          = std::function<size_type(const K&, const V&)>;
+    using EvictionCallback = std::function<void(const K&, V&)>;
+
+    explicit LRUCache(size_type capacity, Weigher weigher = nullptr)
+        : capacity_(capacity), weigher_(std::move(weigher)) {}
+
+    LRUCache(const LRUCache&) = delete;
+    LRUCache& operator=(const LRUCache&) = delete;
+
+    // Returns the value for key and marks it most recently used, or returns
+    // nullptr. Counts a hit or a miss.
+    V* get(const K& key){
+        auto it = index_.find(key);
+        if(it == index_.end()){
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        entries_.move_to_front(it -> second);
+        return &it -> second -> data.value;
+    }
+
+    // Like get, but leaves the recency order and the counters alone.
+    V* peek(const K& key){
+        auto it = index_.find(key);
+        return it == index_.end() ? nullptr : &it -> second -> data.value;
+    }
+
+    bool contains(const K& key) const{
+        return index_.find(key) != index_.end();
+    }
+
+    // Inserts or replaces the value for key and marks it most recently used,
+    // then evicts least recently used entries until the cache fits its
+    // capacity. An entry heavier than the whole capacity is not stored (and
+    // an older value for key is dropped); put returns false for it.
+    bool put(const K& key, V value){
+        size_type w = weigh(key, value);
+        auto it = index_.find(key);
+        if(w > capacity_){
+            if(it != index_.end()) erase_entry(it);
+            return false;
+        }
+        if(it != index_.end()){
+            Node* n = it -> second;
+            n -> data.value = std::move(value);
+            weight_ = weight_ - n -> data.weight + w;
+            n -> data.weight = w;
+            entries_.move_to_front(n);
+        }
+        else{
+            Node* n = entries_.emplace_front(Entry{key, std::move(value), w});
+            try{
+                index_.emplace(key, n);
+            }
+            catch(...){
+                entries_.erase(n);
+                throw;
+            }
+            weight_ += w;
+        }
+        evict_to(capacity_);
+        return true;
+    }
+
+    // Removes key without calling the eviction callback. Returns whether it
+    // was present.
+    bool erase(const K& key){
+        auto it = index_.find(key);
+        if(it == index_.end()) return false;
+        erase_entry(it);
+        return true;
+    }
+
+    // Called with each entry the capacity pushes out, just before it is
+    // destroyed. It must not call back into the cache.
+    void set_eviction_callback(EvictionCallback callback){
+        on_evict_ = std::move(callback);
+    }
+
+    // Changes the capacity, evicting as needed to fit the new one.
+    void set_capacity(size_type capacity){
+        capacity_ = capacity;
+        evict_to(capacity_);
+    }
+
+    // Removes every entry without calling the eviction callback.
+    void clear() noexcept{
+        index_.clear();
+        entries_.clear();
+        weight_ = 0;
+    }
+
+    bool empty() const noexcept {return entries_.empty();}
+    size_type size() const noexcept {return entries_.size();}
+    size_type weight() const noexcept {return weight_;}
+    size_type capacity() const noexcept {return capacity_;}
+
+    size_type hits() const noexcept {return hits_;}
+    size_type misses() const noexcept {return misses_;}
+    size_type evictions() const noexcept {return evictions_;}
+    void reset_stats() noexcept {hits_ = misses_ = evictions_ = 0;}
+
+private:
+    struct Entry{
+        K key;
+        V value;
+        size_type weight;
+    };
+    using List  = DoublyLinkedList<Entry, NodePoolAllocator<Entry>>;
+    using Node  = typename List::Node;
+    using Index = std::unordered_map<K, Node*, Hash, KeyEqual,
+                                     NodePoolAllocator<std::pair<const K, Node*>>>;
+
+    size_type weigh(const K& key, const V& value) const{
+        return weigher_ ? weigher_(key, value) : 1;
+    }
+
+    void erase_entry(typename Index::iterator it) noexcept{
+        Node* n = it -> second;
+        weight_ -= n -> data.weight;
+        index_.erase(it);
+        entries_.erase(n);
+    }
+
+    void evict_to(size_type limit){
+        while(weight_ > limit){
+            Node* n = entries_.tail();
+            assert(n && "weight without entries");
+            if(on_evict_) on_evict_(n -> data.key, n -> data.value);
+            ++evictions_;
+            erase_entry(index_.find(n -> data.key));
+        }
+    }
+
+    List entries_;                  // most recently used first
+    Index index_;
+    size_type capacity_;
+    size_type weight_ = 0;
+    Weigher weigher_;
+    EvictionCallback on_evict_;
+    size_type hits_ = 0;
+    size_type misses_ = 0;
+    size_type evictions_ = 0;
+};
+
+#endif /* LRU_CACHE_HPP */
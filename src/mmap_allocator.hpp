@@ -0,0 +1,143 @@
+#ifndef MMAP_ALLOCATOR_HPP
+#define MMAP_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define DS_HAS_MMAP 1
+#endif
+
+// Allocator for very large DynamicArray<T> buffers of trivially relocatable T.
+//
+// Buffers below ThresholdBytes come from malloc/realloc. At or above it they
+// are anonymous mappings; growing a mapping uses mremap(MREMAP_MAYMOVE) on
+// Linux, which moves page table entries instead of copying bytes, so growth
+// never holds the old and new buffer at the same time. HugePages additionally
+// asks for transparent huge pages (madvise(MADV_HUGEPAGE)).
+//
+// DynamicArray detects reallocate() and uses it instead of allocate + move +
+// deallocate whenever T is trivially relocatable.
+//
+//     DynamicArray<float, LargeBufferAllocator<float>> big;
+template <typename T, std::size_t ThresholdBytes = (std::size_t(1) << 26), bool HugePages = false>
+class LargeBufferAllocator{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind { using other = LargeBufferAllocator<U, ThresholdBytes, HugePages>; };
+
+    static constexpr size_type threshold_bytes = ThresholdBytes;
+
+    LargeBufferAllocator() noexcept = default;
+    template <typename U>
+    LargeBufferAllocator(const LargeBufferAllocator<U, ThresholdBytes, HugePages>&) noexcept {}
+
+    T* allocate(size_type n){
+        size_type bytes = checked_bytes(n);
+        if(is_large(bytes)) return static_cast<T*>(map(bytes));
+        void* p = std::malloc(bytes ? bytes : 1);
+        if(!p) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_type n) noexcept{
+        size_type bytes = n * sizeof(T);
+        if(is_large(bytes)) unmap(p, bytes);
+        else std::free(p);
+    }
+
+    // Resizes the buffer at p from old_n to new_n elements, keeping the first
+    // min(old_n, new_n) elements bytewise. Returns the (possibly moved) buffer;
+    // on failure throws std::bad_alloc and p stays valid.
+    T* reallocate(T* p, size_type old_n, size_type new_n){
+        size_type old_bytes = old_n * sizeof(T);
+        size_type new_bytes = checked_bytes(new_n);
+        bool old_large = is_large(old_bytes);
+        bool new_large = is_large(new_bytes);
+
+        if(!old_large && !new_large){
+            void* q = std::realloc(p, new_bytes ? new_bytes : 1);
+            if(!q) throw std::bad_alloc();
+            return static_cast<T*>(q);
+        }
+#if defined(__linux__)
+        if(old_large && new_large){
+            size_type old_len = page_round(old_bytes);
+            size_type new_len = page_round(new_bytes);
+            if(old_len == new_len) return p;
+            void* q = ::mremap(p, old_len, new_len, MREMAP_MAYMOVE);
+            if(q == MAP_FAILED) throw std::bad_alloc();
+            if(HugePages && new_len > old_len) advise_huge(q, new_len);
+            return static_cast<T*>(q);
+        }
+#endif
+        // crossing the threshold (or no mremap): copy once
+        T* q = allocate(new_n);
+        std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), old_bytes < new_bytes ? old_bytes : new_bytes);
+        deallocate(p, old_n);
+        return q;
+    }
+
+private:
+    static bool is_large(size_type bytes) noexcept{
+#if defined(DS_HAS_MMAP)
+        return bytes >= ThresholdBytes;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    static size_type checked_bytes(size_type n){
+        if(n > size_type(-1) / sizeof(T)) throw std::bad_array_new_length();
+        return n * sizeof(T);
+    }
+
+#if defined(DS_HAS_MMAP)
+    static size_type page_round(size_type bytes) noexcept{
+        static const size_type page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+        return (bytes + page - 1) / page * page;
+    }
+
+    static void advise_huge(void* p, size_type len) noexcept{
+#if defined(MADV_HUGEPAGE)
+        ::madvise(p, len, MADV_HUGEPAGE);
+#else
+        (void)p; (void)len;
+#endif
+    }
+
+    static void* map(size_type bytes){
+        size_type len = page_round(bytes);
+        void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(p == MAP_FAILED) throw std::bad_alloc();
+        if(HugePages) advise_huge(p, len);
+        return p;
+    }
+
+    static void unmap(void* p, size_type bytes) noexcept{
+        if(p) ::munmap(p, page_round(bytes));
+    }
+#else
+    static void* map(size_type) { throw std::bad_alloc(); }
+    static void unmap(void*, size_type) noexcept {}
+#endif
+};
+
+template <typename T, typename U, std::size_t Th, bool H>
+bool operator==(const LargeBufferAllocator<T, Th, H>&, const LargeBufferAllocator<U, Th, H>&) noexcept { return true; }
+
+template <typename T, typename U, std::size_t Th, bool H>
+bool operator!=(const LargeBufferAllocator<T, Th, H>&, const LargeBufferAllocator<U, Th, H>&) noexcept { return false; }
+
+#endif /* MMAP_ALLOCATOR_HPP */
@@ -0,0 +1,119 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "dynamic_array.hpp"
+#include "thread_pool.hpp"
+
+// Data-parallel passes over contiguous ranges (DynamicArray or any
+// [first, last) pointer pair) on a ThreadPool.
+//
+// The range is split statically into one chunk per pool thread. Interior
+// chunk boundaries are rounded to 64-byte cache-line boundaries of the range
+// being written, so no two threads ever store into the same line.
+
+namespace parallel{
+
+    constexpr std::size_t cache_line = 64;
+
+    namespace detail{
+
+        // Start index of chunk i of `chunks` over n elements beginning at base.
+        template <typename T>
+        std::size_t chunk_begin(const T* base, std::size_t n, std::size_t chunks, std::size_t i) noexcept{
+            if(i == 0) return 0;
+            if(i >= chunks) return n;
+            std::size_t k = n / chunks * i + n % chunks * i / chunks;
+            if(cache_line % sizeof(T) != 0) return k;    // elements straddle lines anyway
+            std::size_t per_line = cache_line / sizeof(T);
+            std::size_t head = (reinterpret_cast<std::uintptr_t>(base) % cache_line) / sizeof(T);
+            std::size_t aligned = (k + head + per_line - 1) / per_line * per_line - head;
+            return aligned < n ? aligned : n;
+        }
+
+        // Calls fn(begin, end) for each chunk of [0, n), boundaries aligned on base.
+        template <typename T, typename F>
+        void for_chunks(ThreadPool& pool, const T* base, std::size_t n, F&& fn){
+            if(n == 0) return;
+            std::size_t chunks = pool.size() < n ? pool.size() : n;
+            pool.run(chunks, [&](std::size_t c){
+                std::size_t b = chunk_begin(base, n, chunks, c);
+                std::size_t e = chunk_begin(base, n, chunks, c + 1);
+                if(b < e) fn(b, e);
+            });
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    void fill(ThreadPool& pool, T* first, T* last, const T& value){
+        detail::for_chunks(pool, first, static_cast<std::size_t>(last - first), [&](std::size_t b, std::size_t e){
+            for(std::size_t i = b; i < e; ++i) first[i] = value;
+        });
+    }
+
+    template <typename T, typename F>
+    void for_each(ThreadPool& pool, T* first, T* last, F fn){
+        detail::for_chunks(pool, first, static_cast<std::size_t>(last - first), [&](std::size_t b, std::size_t e){
+            for(std::size_t i = b; i < e; ++i) fn(first[i]);
+        });
+    }
+
+    // out[i] = fn(first[i]); chunks are aligned on the output range.
+    template <typename T, typename U, typename F>
+    void transform(ThreadPool& pool, const T* first, const T* last, U* out, F fn){
+        detail::for_chunks(pool, out, static_cast<std::size_t>(last - first), [&](std::size_t b, std::size_t e){
+            for(std::size_t i = b; i < e; ++i) out[i] = fn(first[i]);
+        });
+    }
+
+    // Folds each chunk from init, then folds the partial results in chunk
+    // order. op must be associative and init its identity.
+    template <typename T, typename R, typename Op>
+    R reduce(ThreadPool& pool, const T* first, const T* last, R init, Op op){
+        std::size_t n = static_cast<std::size_t>(last - first);
+        if(n == 0) return init;
+        struct alignas(cache_line) Slot{ R value; };   // one line per partial
+        std::size_t chunks = pool.size() < n ? pool.size() : n;
+        DynamicArray<Slot> partial(chunks, Slot{init});
+        pool.run(chunks, [&](std::size_t c){
+            std::size_t b = detail::chunk_begin(first, n, chunks, c);
+            std::size_t e = detail::chunk_begin(first, n, chunks, c + 1);
+            R acc = init;
+            for(std::size_t i = b; i < e; ++i) acc = op(acc, first[i]);
+            partial[c].value = acc;
+        });
+        R result = partial[0].value;
+        for(std::size_t c = 1; c < chunks; ++c) result = op(result, partial[c].value);
+        return result;
+    }
+
+    // DynamicArray overloads
+
+    template <typename T, typename A, typename P>
+    void fill(ThreadPool& pool, DynamicArray<T, A, P>& arr, const T& value){
+        fill(pool, arr.begin(), arr.end(), value);
+    }
+
+    template <typename T, typename A, typename P, typename F>
+    void for_each(ThreadPool& pool, DynamicArray<T, A, P>& arr, F fn){
+        for_each(pool, arr.begin(), arr.end(), std::move(fn));
+    }
+
+    // out must already hold arr.size() elements
+    template <typename T, typename A, typename P, typename U, typename A2, typename P2, typename F>
+    void transform(ThreadPool& pool, const DynamicArray<T, A, P>& arr, DynamicArray<U, A2, P2>& out, F fn){
+        assert(out.size() >= arr.size() && "transform output too small");
+        transform(pool, arr.begin(), arr.end(), out.begin(), std::move(fn));
+    }
+
+    template <typename T, typename A, typename P, typename R, typename Op>
+    R reduce(ThreadPool& pool, const DynamicArray<T, A, P>& arr, R init, Op op){
+        return reduce(pool, arr.begin(), arr.end(), std::move(init), std::move(op));
+    }
+
+} // namespace parallel
+
+#endif /* PARALLEL_HPP */
@@ -0,0 +1,184 @@
+#ifndef RELOCATION_HPP
+#define RELOCATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// A type is trivially relocatable when moving an object to a new address and
+// ending the lifetime of the old one is equivalent to copying its bytes.
+// Every trivially copyable type qualifies. Other types (e.g. a struct holding
+// a std::unique_ptr) can opt in by specializing the trait:
+//
+//     template<> struct is_trivially_relocatable<MyType> : std::true_type {};
+//
+// Do not opt in types that store pointers into themselves.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Relocating a T cannot throw: its bytes are copied or its move constructor
+// is noexcept. Only such types may be shifted through a raw gap.
+template <typename T>
+inline constexpr bool is_nothrow_relocatable_v =
+    is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible<T>::value;
+
+namespace relocation{
+
+    // Allocators may offer T* reallocate(T* p, size_t old_n, size_t new_n)
+    // that resizes a buffer keeping its bytes (realloc, mremap). Containers use
+    // it in place of allocate + relocate + deallocate for trivially relocatable T.
+    template <typename Alloc, typename T, typename = void>
+    struct allocator_can_reallocate : std::false_type {};
+
+    template <typename Alloc, typename T>
+    struct allocator_can_reallocate<Alloc, T, std::void_t<decltype(
+        std::declval<Alloc&>().reallocate(std::declval<T*>(), std::size_t(), std::size_t()))>>
+        : std::integral_constant<bool, is_trivially_relocatable_v<T>> {};
+
+    // Phase one of a relocation: builds [src, src + n) into the raw,
+    // non-overlapping memory at dst without ending the source lifetimes, so a
+    // caller staging several ranges can still back out.
+    // On exception nothing is left constructed in dst.
+    template <typename Alloc, typename T>
+    void relocate_prepare_n(Alloc& alloc, T* src, std::size_t n, T* dst){
+        using traits = std::allocator_traits<Alloc>;
+        if(n == 0) return;
+        if constexpr (is_trivially_relocatable_v<T>){
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        }
+        else{
+            std::size_t i = 0;
+            try{
+                for(; i < n; ++i){
+                    traits::construct(alloc, dst + i, std::move_if_noexcept(src[i]));
+                }
+            }
+            catch(...){
+                for(std::size_t j = 0; j < i; ++j) traits::destroy(alloc, dst + j);
+                throw;
+            }
+        }
+    }
+
+    // Phase two: ends the lifetimes of the (moved-from) source range.
+    template <typename Alloc, typename T>
+    void relocate_finish_n(Alloc& alloc, T* src, std::size_t n) noexcept{
+        using traits = std::allocator_traits<Alloc>;
+        if constexpr (!is_trivially_relocatable_v<T>){
+            for(std::size_t j = 0; j < n; ++j) traits::destroy(alloc, src + j);
+        }
+        else{
+            (void)alloc; (void)src; (void)n;
+        }
+    }
+
+    // Backs out of phase one after a later step threw: drops the copies in dst.
+    // Only copying constructions can throw (nothrow-movable types are moved),
+    // so whenever an abort is needed the source still holds intact elements.
+    template <typename Alloc, typename T>
+    void relocate_abort_n(Alloc& alloc, T* dst, std::size_t n) noexcept{
+        relocate_finish_n(alloc, dst, n);
+    }
+
+    // Relocates [src, src + n) into the raw, non-overlapping memory at dst.
+    // On return the source range is raw memory.
+    // Strong guarantee: if an element constructor throws, everything built in
+    // dst is destroyed and the source range is left untouched.
+    template <typename Alloc, typename T>
+    void relocate_n(Alloc& alloc, T* src, std::size_t n, T* dst){
+        relocate_prepare_n(alloc, src, n, dst);
+        relocate_finish_n(alloc, src, n);
+    }
+
+    // Moves [data + index, data + end) up by count slots, leaving
+    // [data + index, data + index + count) as raw memory.
+    // The caller guarantees room for end + count elements. Only for
+    // nothrow-relocatable T, so the range is never left with holes.
+    template <typename Alloc, typename T>
+    void shift_right(Alloc& alloc, T* data, std::size_t index, std::size_t end, std::size_t count) noexcept{
+        static_assert(is_nothrow_relocatable_v<T>,
+                      "a throwing move would leave raw slots inside the range; use insert_by_assignment");
+        using traits = std::allocator_traits<Alloc>;
+        if(count == 0 || index >= end) return;
+        if constexpr (is_trivially_relocatable_v<T>){
+            std::memmove(static_cast<void*>(data + index + count),
+                         static_cast<const void*>(data + index), (end - index) * sizeof(T));
+        }
+        else{
+            // walk backwards so a source slot is never overwritten before it is moved
+            for(std::size_t i = end; i-- > index;){
+                traits::construct(alloc, data + i + count, std::move(data[i]));
+                traits::destroy(alloc, data + i);
+            }
+        }
+    }
+
+    // Moves [data + index + count, data + end) down by count slots into the
+    // raw gap at [data + index, data + index + count), leaving
+    // [data + end - count, data + end) as raw memory.
+    template <typename Alloc, typename T>
+    void shift_left(Alloc& alloc, T* data, std::size_t index, std::size_t end, std::size_t count) noexcept{
+        static_assert(is_nothrow_relocatable_v<T>,
+                      "a throwing move would leave raw slots inside the range; use erase_n");
+        using traits = std::allocator_traits<Alloc>;
+        if(count == 0 || index + count >= end) return;
+        if constexpr (is_trivially_relocatable_v<T>){
+            std::memmove(static_cast<void*>(data + index),
+                         static_cast<const void*>(data + index + count), (end - index - count) * sizeof(T));
+        }
+        else{
+            for(std::size_t i = index + count; i < end; ++i){
+                traits::construct(alloc, data + i - count, std::move(data[i]));
+                traits::destroy(alloc, data + i);
+            }
+        }
+    }
+
+    // Inserts value at index for T whose relocation may throw, never leaving
+    // a raw slot inside [data, data + size): builds the new last slot from
+    // the old last element, moves the rest up one by assignment and assigns
+    // value into place. size counts the new slot as soon as it is built, so
+    // if an assignment throws every element is still live (basic guarantee).
+    // The caller guarantees room for size + 1 elements and that value does
+    // not refer into the array.
+    template <typename Alloc, typename T, typename Size, typename U>
+    void insert_by_assignment(Alloc& alloc, T* data, std::size_t index, Size& size, U&& value){
+        using traits = std::allocator_traits<Alloc>;
+        if(index == size){
+            traits::construct(alloc, data + size, std::forward<U>(value));
+            ++size;
+            return;
+        }
+        traits::construct(alloc, data + size, std::move_if_noexcept(data[size - 1]));
+        ++size;
+        for(std::size_t i = size - 2; i > index; --i) data[i] = std::move_if_noexcept(data[i - 1]);
+        data[index] = std::forward<U>(value);
+    }
+
+    // Removes the count elements at index from [data, data + end), leaving
+    // [data + end - count, data + end) as raw memory. Nothrow-relocatable T
+    // close the gap with shift_left; other T are moved down by assignment
+    // before the last count are destroyed, so if an assignment throws
+    // nothing has been destroyed and every slot is still live.
+    template <typename Alloc, typename T>
+    void erase_n(Alloc& alloc, T* data, std::size_t index, std::size_t end, std::size_t count){
+        using traits = std::allocator_traits<Alloc>;
+        if constexpr (is_nothrow_relocatable_v<T>){
+            for(std::size_t i = index; i < index + count; ++i) traits::destroy(alloc, data + i);
+            shift_left(alloc, data, index, end, count);
+        }
+        else{
+            std::move(data + index + count, data + end, data + index);
+            for(std::size_t i = end - count; i < end; ++i) traits::destroy(alloc, data + i);
+        }
+    }
+
+} // namespace relocation
+
+#endif /* RELOCATION_HPP */
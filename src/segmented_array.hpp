@@ -0,0 +1,249 @@
+#ifndef SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY_HPP
+
+#include <memory>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include "dynamic_array.hpp"
+
+namespace segmented_detail{
+    // largest power of two <= max(1, 4096 / sizeof(T)): about one page per block
+    template <typename T>
+    constexpr std::size_t default_block_size() noexcept{
+        std::size_t want = 4096 / sizeof(T);
+        std::size_t b = 1;
+        while(b * 2 <= want) b *= 2;
+        return b;
+    }
+} // namespace segmented_detail
+
+// Array of fixed-size blocks of BlockSize elements, found through a small
+// DynamicArray<T*> index. Appending fills the last block or adds a new one;
+// existing elements never move, so push_back has no O(n) relocation spike
+// and references stay valid until the element is removed. Only the index
+// (one pointer per block) is ever reallocated.
+//
+// operator[] is O(1): index / BlockSize picks the block, index % BlockSize
+// the slot (shifts and masks, BlockSize is a power of two). for_each_block
+// hands out contiguous runs for scans that want plain pointer loops.
+template <typename T, std::size_t BlockSize = segmented_detail::default_block_size<T>()>
+class SegmentedArray{
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two");
+    using Allocator    = std::allocator<T>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    static constexpr size_type block_size = BlockSize;
+
+    template <bool Const>
+    class Iterator{
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() noexcept : blocks_(nullptr), index_(0) {}
+        Iterator(T* const* blocks, size_type index) noexcept : blocks_(blocks), index_(index) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) noexcept : blocks_(other.blocks_), index_(other.index_) {}
+
+        reference operator*() const { return blocks_[index_ / BlockSize][index_ % BlockSize]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        Iterator& operator++() noexcept { ++index_; return *this; }
+        Iterator operator++(int) noexcept { Iterator t = *this; ++index_; return t; }
+        Iterator& operator--() noexcept { --index_; return *this; }
+        Iterator operator--(int) noexcept { Iterator t = *this; --index_; return t; }
+        Iterator& operator+=(difference_type n) noexcept { index_ += n; return *this; }
+        Iterator& operator-=(difference_type n) noexcept { index_ -= n; return *this; }
+        friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept{
+            return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.index_ == b.index_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.index_ != b.index_; }
+        friend bool operator<(const Iterator& a, const Iterator& b) noexcept { return a.index_ < b.index_; }
+        friend bool operator>(const Iterator& a, const Iterator& b) noexcept { return a.index_ > b.index_; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) noexcept { return a.index_ <= b.index_; }
+        friend bool operator>=(const Iterator& a, const Iterator& b) noexcept { return a.index_ >= b.index_; }
+
+    private:
+        friend class Iterator<!Const>;
+        T* const* blocks_;
+        size_type index_;
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SegmentedArray() noexcept : size_(0) {}
+
+    explicit SegmentedArray(size_type n, const T& value = T())
+        :SegmentedArray()
+    {
+        reserve(n);
+        for(size_type i = 0; i < n; ++i) push_back(value);
+    }
+
+    //copy ctor
+    SegmentedArray(const SegmentedArray& other)
+        :SegmentedArray()
+    {
+        reserve(other.size_);
+        other.for_each_block([this](const T* p, size_type n){
+            for(size_type i = 0; i < n; ++i) push_back(p[i]);
+        });
+    }
+
+    //move ctor: takes the blocks, nothing moves
+    SegmentedArray(SegmentedArray&& other) noexcept
+        :blocks_(std::move(other.blocks_)), size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+
+    ~SegmentedArray(){
+        clear();
+    }
+
+    SegmentedArray& operator=(const SegmentedArray& other){
+        if(this == &other) return *this;
+        SegmentedArray temp(other);
+        swap(temp);
+        return *this;
+    }
+
+    SegmentedArray& operator=(SegmentedArray&& other) noexcept{
+        if(this == &other) return *this;
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    void swap(SegmentedArray& other) noexcept{
+        blocks_.swap(other.blocks_);
+        std::swap(size_, other.size_);
+    }
+
+    // allocates blocks for n elements; never moves elements
+    void reserve(size_type n){
+        size_type need = (n + BlockSize - 1) / BlockSize;
+        if(need <= blocks_.size()) return;
+        blocks_.reserve(need);
+        while(blocks_.size() < need) add_block();
+    }
+
+    // frees whole blocks past the last element
+    void shrink_to_fit(){
+        size_type keep = (size_ + BlockSize - 1) / BlockSize;
+        while(blocks_.size() > keep){
+            alloc_traits::deallocate(alloc_, blocks_[blocks_.size() - 1], BlockSize);
+            blocks_.pop_back();
+        }
+        blocks_.shrink_to_fit();
+    }
+
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return blocks_.size() * BlockSize; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args){
+        if(size_ == capacity()) add_block();
+        T* slot = blocks_[size_ / BlockSize] + size_ % BlockSize;
+        alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void pop_back(){
+        assert(size_ > 0 && "Pop back on empty SegmentedArray");
+        --size_;
+        alloc_traits::destroy(alloc_, blocks_[size_ / BlockSize] + size_ % BlockSize);
+    }
+
+    // destroys every element and frees every block
+    void clear() noexcept{
+        for_each_block([this](T* p, size_type n){
+            for(size_type i = 0; i < n; ++i) alloc_traits::destroy(alloc_, p + i);
+        });
+        for(T* b : blocks_) alloc_traits::deallocate(alloc_, b, BlockSize);
+        blocks_.clear();
+        size_ = 0;
+    }
+
+    T& operator[](size_type index){
+        assert(index < size_ && "index out of bound");
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+    const T& operator[](size_type index) const {
+        assert(index < size_ && "index out of bound");
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    // Calls fn(T* data, size_type n) for each contiguous run of elements, in order.
+    template <typename F>
+    void for_each_block(F&& fn){
+        for(size_type b = 0, left = size_; left > 0; ++b){
+            size_type n = left < BlockSize ? left : BlockSize;
+            fn(blocks_[b], n);
+            left -= n;
+        }
+    }
+
+    template <typename F>
+    void for_each_block(F&& fn) const {
+        for(size_type b = 0, left = size_; left > 0; ++b){
+            size_type n = left < BlockSize ? left : BlockSize;
+            fn(static_cast<const T*>(blocks_[b]), n);
+            left -= n;
+        }
+    }
+
+    iterator begin() noexcept { return iterator(blocks_.data(), 0); }
+    iterator end() noexcept { return iterator(blocks_.data(), size_); }
+    const_iterator begin() const noexcept { return const_iterator(blocks_.data(), 0); }
+    const_iterator end() const noexcept { return const_iterator(blocks_.data(), size_); }
+
+private:
+    Allocator alloc_;
+    DynamicArray<T*, std::allocator<T*>, RetainCapacityPolicy> blocks_;
+    size_type size_;
+
+    void add_block(){
+        T* block = alloc_traits::allocate(alloc_, BlockSize);
+        try{
+            blocks_.push_back(block);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, block, BlockSize);
+            throw;
+        }
+    }
+};
+
+#endif /* SEGMENTED_ARRAY_HPP */
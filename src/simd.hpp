@@ -0,0 +1,588 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "dynamic_array.hpp"
+
+// Explicitly vectorized linear kernels for arrays of arithmetic types:
+//
+//     simd::find(arr, v)   index of the first element == v, or arr.size()
+//     simd::count(arr, v)  number of elements == v
+//     simd::min(arr)       smallest element (arr must not be empty)
+//     simd::max(arr)       largest element  (arr must not be empty)
+//     simd::sum(arr)       sum, widened: int32 -> int64, float -> double,
+//                          uint64 wraps modulo 2^64
+//
+// int32_t, float and uint64_t have SSE2 and AVX2 implementations; the widest
+// one the CPU supports is picked at runtime (set_isa can force a narrower one).
+// Every other arithmetic type, and non-x86 targets, use the scalar loops.
+// float min/max with NaNs in the input are unspecified.
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define DS_SIMD_X86 1
+#include <immintrin.h>
+#define DS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace simd{
+
+    enum class Isa { scalar, sse2, avx2 };
+
+    template <typename T>
+    using sum_t = std::conditional_t<std::is_floating_point<T>::value, double,
+                  std::conditional_t<std::is_signed<T>::value, long long, unsigned long long>>;
+
+    inline bool supported(Isa isa) noexcept{
+        switch(isa){
+            case Isa::scalar: return true;
+#if defined(DS_SIMD_X86)
+            case Isa::sse2:   return __builtin_cpu_supports("sse2");
+            case Isa::avx2:   return __builtin_cpu_supports("avx2");
+#endif
+            default:          return false;
+        }
+    }
+
+    namespace detail{
+        inline Isa best_isa() noexcept{
+            if(supported(Isa::avx2)) return Isa::avx2;
+            if(supported(Isa::sse2)) return Isa::sse2;
+            return Isa::scalar;
+        }
+
+        // counting kernels keep 32-bit per-lane counters; flushing them every
+        // count_block elements keeps them from wrapping
+        constexpr std::size_t count_block = std::size_t(1) << 24;
+
+        inline Isa& current_isa() noexcept{
+            static Isa isa = best_isa();
+            return isa;
+        }
+    } // namespace detail
+
+    inline Isa active_isa() noexcept { return detail::current_isa(); }
+
+    // Forces the kernels onto isa, or the best supported ISA below it.
+    // Meant for tests and benchmarks; not synchronized with running kernels.
+    inline void set_isa(Isa isa) noexcept{
+        while(!supported(isa)) isa = static_cast<Isa>(static_cast<int>(isa) - 1);
+        detail::current_isa() = isa;
+    }
+
+    // scalar reference kernels, any arithmetic T
+
+    namespace scalar{
+
+        template <typename T>
+        std::size_t find(const T* p, std::size_t n, T value) noexcept{
+            for(std::size_t i = 0; i < n; ++i) if(p[i] == value) return i;
+            return n;
+        }
+
+        template <typename T>
+        std::size_t count(const T* p, std::size_t n, T value) noexcept{
+            std::size_t c = 0;
+            for(std::size_t i = 0; i < n; ++i) c += (p[i] == value);
+            return c;
+        }
+
+        template <typename T>
+        T min(const T* p, std::size_t n) noexcept{
+            assert(n > 0 && "min of empty range");
+            T m = p[0];
+            for(std::size_t i = 1; i < n; ++i) if(p[i] < m) m = p[i];
+            return m;
+        }
+
+        template <typename T>
+        T max(const T* p, std::size_t n) noexcept{
+            assert(n > 0 && "max of empty range");
+            T m = p[0];
+            for(std::size_t i = 1; i < n; ++i) if(m < p[i]) m = p[i];
+            return m;
+        }
+
+        template <typename T>
+        sum_t<T> sum(const T* p, std::size_t n) noexcept{
+            sum_t<T> s = 0;
+            for(std::size_t i = 0; i < n; ++i) s += p[i];
+            return s;
+        }
+
+    } // namespace scalar
+
+#if defined(DS_SIMD_X86)
+
+    namespace sse2{
+
+        inline __m128i load(const void* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+
+        // lane masks -> one bit per element
+        inline int mask_i32(__m128i m) noexcept { return _mm_movemask_ps(_mm_castsi128_ps(m)); }
+        // a 64-bit lane matches when both of its 32-bit halves match
+        inline __m128i eq_u64(__m128i a, __m128i b) noexcept{
+            __m128i m32 = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(m32, _mm_shuffle_epi32(m32, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        inline int mask_u64(__m128i m) noexcept { return _mm_movemask_pd(_mm_castsi128_pd(m)); }
+
+        inline std::size_t hsum_u32(__m128i v) noexcept{
+            alignas(16) std::uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+            return std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+
+        inline __m128i min_i32(__m128i a, __m128i b) noexcept{
+            __m128i gt = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+        }
+        inline __m128i max_i32(__m128i a, __m128i b) noexcept{
+            __m128i gt = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+        }
+
+        // int32_t
+
+        inline std::size_t find(const std::int32_t* p, std::size_t n, std::int32_t v) noexcept{
+            const __m128i vv = _mm_set1_epi32(v);
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                int m = mask_i32(_mm_cmpeq_epi32(load(p + i), vv));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        inline std::size_t count(const std::int32_t* p, std::size_t n, std::int32_t v) noexcept{
+            const __m128i vv = _mm_set1_epi32(v);
+            std::size_t c = 0, i = 0;
+            while(i + 4 <= n){
+                // matching lanes are all ones, i.e. -1
+                __m128i acc = _mm_setzero_si128();
+                std::size_t end = n - i > detail::count_block ? i + detail::count_block : n;
+                for(; i + 4 <= end; i += 4) acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(load(p + i), vv));
+                c += hsum_u32(acc);
+            }
+            return c + scalar::count(p + i, n - i, v);
+        }
+
+        inline std::int32_t min(const std::int32_t* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::min(p, n);
+            __m128i m = load(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4) m = min_i32(m, load(p + i));
+            alignas(16) std::int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), m);
+            std::int32_t r = scalar::min(lanes, 4);
+            return i < n ? (scalar::min(p + i, n - i) < r ? scalar::min(p + i, n - i) : r) : r;
+        }
+
+        inline std::int32_t max(const std::int32_t* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::max(p, n);
+            __m128i m = load(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4) m = max_i32(m, load(p + i));
+            alignas(16) std::int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), m);
+            std::int32_t r = scalar::max(lanes, 4);
+            return i < n ? (r < scalar::max(p + i, n - i) ? scalar::max(p + i, n - i) : r) : r;
+        }
+
+        inline long long sum(const std::int32_t* p, std::size_t n) noexcept{
+            __m128i acc = _mm_setzero_si128();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                __m128i x = load(p + i);
+                __m128i sign = _mm_srai_epi32(x, 31);               // sign-extend to 64 bits
+                acc = _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(x, sign), _mm_unpackhi_epi32(x, sign)));
+            }
+            alignas(16) long long lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+        }
+
+        // float
+
+        inline std::size_t find(const float* p, std::size_t n, float v) noexcept{
+            const __m128 vv = _mm_set1_ps(v);
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                int m = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), vv));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        inline std::size_t count(const float* p, std::size_t n, float v) noexcept{
+            const __m128 vv = _mm_set1_ps(v);
+            std::size_t c = 0, i = 0;
+            while(i + 4 <= n){
+                __m128i acc = _mm_setzero_si128();
+                std::size_t end = n - i > detail::count_block ? i + detail::count_block : n;
+                for(; i + 4 <= end; i += 4)
+                    acc = _mm_sub_epi32(acc, _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(p + i), vv)));
+                c += hsum_u32(acc);
+            }
+            return c + scalar::count(p + i, n - i, v);
+        }
+
+        inline float min(const float* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::min(p, n);
+            __m128 m = _mm_loadu_ps(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4) m = _mm_min_ps(m, _mm_loadu_ps(p + i));
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, m);
+            float r = scalar::min(lanes, 4);
+            return i < n ? (scalar::min(p + i, n - i) < r ? scalar::min(p + i, n - i) : r) : r;
+        }
+
+        inline float max(const float* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::max(p, n);
+            __m128 m = _mm_loadu_ps(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4) m = _mm_max_ps(m, _mm_loadu_ps(p + i));
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, m);
+            float r = scalar::max(lanes, 4);
+            return i < n ? (r < scalar::max(p + i, n - i) ? scalar::max(p + i, n - i) : r) : r;
+        }
+
+        inline double sum(const float* p, std::size_t n) noexcept{
+            __m128d lo = _mm_setzero_pd(), hi = _mm_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                __m128 x = _mm_loadu_ps(p + i);
+                lo = _mm_add_pd(lo, _mm_cvtps_pd(x));
+                hi = _mm_add_pd(hi, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+            }
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, _mm_add_pd(lo, hi));
+            return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+        }
+
+        // uint64_t (SSE2 has no 64-bit compare, so min/max stay scalar)
+
+        inline std::size_t find(const std::uint64_t* p, std::size_t n, std::uint64_t v) noexcept{
+            const __m128i vv = _mm_set1_epi64x(static_cast<long long>(v));
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2){
+                int m = mask_u64(eq_u64(load(p + i), vv));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        inline std::size_t count(const std::uint64_t* p, std::size_t n, std::uint64_t v) noexcept{
+            const __m128i vv = _mm_set1_epi64x(static_cast<long long>(v));
+            __m128i acc = _mm_setzero_si128();
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2) acc = _mm_sub_epi64(acc, eq_u64(load(p + i), vv));
+            alignas(16) std::uint64_t lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return static_cast<std::size_t>(lanes[0] + lanes[1]) + scalar::count(p + i, n - i, v);
+        }
+
+        inline std::uint64_t min(const std::uint64_t* p, std::size_t n) noexcept { return scalar::min(p, n); }
+        inline std::uint64_t max(const std::uint64_t* p, std::size_t n) noexcept { return scalar::max(p, n); }
+
+        inline unsigned long long sum(const std::uint64_t* p, std::size_t n) noexcept{
+            __m128i acc = _mm_setzero_si128();
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2) acc = _mm_add_epi64(acc, load(p + i));
+            alignas(16) std::uint64_t lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+        }
+
+    } // namespace sse2
+
+    namespace avx2{
+
+        DS_TARGET_AVX2 inline __m256i load(const void* p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+        DS_TARGET_AVX2 inline int mask_i32(__m256i m) noexcept { return _mm256_movemask_ps(_mm256_castsi256_ps(m)); }
+        DS_TARGET_AVX2 inline int mask_u64(__m256i m) noexcept { return _mm256_movemask_pd(_mm256_castsi256_pd(m)); }
+
+        DS_TARGET_AVX2 inline std::size_t hsum_u32(__m256i v) noexcept{
+            alignas(32) std::uint32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+            std::size_t s = 0;
+            for(std::uint32_t x : lanes) s += x;
+            return s;
+        }
+
+        // unsigned 64-bit compare via the signed one on sign-flipped values
+        DS_TARGET_AVX2 inline __m256i gt_u64(__m256i a, __m256i b) noexcept{
+            const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(1ULL << 63));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+
+        // int32_t
+
+        DS_TARGET_AVX2 inline std::size_t find(const std::int32_t* p, std::size_t n, std::int32_t v) noexcept{
+            const __m256i vv = _mm256_set1_epi32(v);
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                int m = mask_i32(_mm256_cmpeq_epi32(load(p + i), vv));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline std::size_t count(const std::int32_t* p, std::size_t n, std::int32_t v) noexcept{
+            const __m256i vv = _mm256_set1_epi32(v);
+            std::size_t c = 0, i = 0;
+            while(i + 8 <= n){
+                __m256i acc = _mm256_setzero_si256();
+                std::size_t end = n - i > detail::count_block ? i + detail::count_block : n;
+                for(; i + 8 <= end; i += 8) acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(load(p + i), vv));
+                c += hsum_u32(acc);
+            }
+            return c + scalar::count(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline std::int32_t min(const std::int32_t* p, std::size_t n) noexcept{
+            if(n < 8) return scalar::min(p, n);
+            __m256i m = load(p);
+            std::size_t i = 8;
+            for(; i + 8 <= n; i += 8) m = _mm256_min_epi32(m, load(p + i));
+            alignas(32) std::int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+            std::int32_t r = scalar::min(lanes, 8);
+            return i < n ? (scalar::min(p + i, n - i) < r ? scalar::min(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline std::int32_t max(const std::int32_t* p, std::size_t n) noexcept{
+            if(n < 8) return scalar::max(p, n);
+            __m256i m = load(p);
+            std::size_t i = 8;
+            for(; i + 8 <= n; i += 8) m = _mm256_max_epi32(m, load(p + i));
+            alignas(32) std::int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+            std::int32_t r = scalar::max(lanes, 8);
+            return i < n ? (r < scalar::max(p + i, n - i) ? scalar::max(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline long long sum(const std::int32_t* p, std::size_t n) noexcept{
+            __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                __m256i x = load(p + i);
+                acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+            }
+            alignas(32) long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(p + i, n - i);
+        }
+
+        // float
+
+        DS_TARGET_AVX2 inline std::size_t find(const float* p, std::size_t n, float v) noexcept{
+            const __m256 vv = _mm256_set1_ps(v);
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                int m = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), vv, _CMP_EQ_OQ));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline std::size_t count(const float* p, std::size_t n, float v) noexcept{
+            const __m256 vv = _mm256_set1_ps(v);
+            std::size_t c = 0, i = 0;
+            while(i + 8 <= n){
+                __m256i acc = _mm256_setzero_si256();
+                std::size_t end = n - i > detail::count_block ? i + detail::count_block : n;
+                for(; i + 8 <= end; i += 8)
+                    acc = _mm256_sub_epi32(acc, _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(p + i), vv, _CMP_EQ_OQ)));
+                c += hsum_u32(acc);
+            }
+            return c + scalar::count(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline float min(const float* p, std::size_t n) noexcept{
+            if(n < 8) return scalar::min(p, n);
+            __m256 m = _mm256_loadu_ps(p);
+            std::size_t i = 8;
+            for(; i + 8 <= n; i += 8) m = _mm256_min_ps(m, _mm256_loadu_ps(p + i));
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, m);
+            float r = scalar::min(lanes, 8);
+            return i < n ? (scalar::min(p + i, n - i) < r ? scalar::min(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline float max(const float* p, std::size_t n) noexcept{
+            if(n < 8) return scalar::max(p, n);
+            __m256 m = _mm256_loadu_ps(p);
+            std::size_t i = 8;
+            for(; i + 8 <= n; i += 8) m = _mm256_max_ps(m, _mm256_loadu_ps(p + i));
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, m);
+            float r = scalar::max(lanes, 8);
+            return i < n ? (r < scalar::max(p + i, n - i) ? scalar::max(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline double sum(const float* p, std::size_t n) noexcept{
+            __m256d lo = _mm256_setzero_pd(), hi = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                __m256 x = _mm256_loadu_ps(p + i);
+                lo = _mm256_add_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+                hi = _mm256_add_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, _mm256_add_pd(lo, hi));
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(p + i, n - i);
+        }
+
+        // uint64_t
+
+        DS_TARGET_AVX2 inline std::size_t find(const std::uint64_t* p, std::size_t n, std::uint64_t v) noexcept{
+            const __m256i vv = _mm256_set1_epi64x(static_cast<long long>(v));
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                int m = mask_u64(_mm256_cmpeq_epi64(load(p + i), vv));
+                if(m) return i + __builtin_ctz(m);
+            }
+            return i + scalar::find(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline std::size_t count(const std::uint64_t* p, std::size_t n, std::uint64_t v) noexcept{
+            const __m256i vv = _mm256_set1_epi64x(static_cast<long long>(v));
+            __m256i acc = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4) acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(load(p + i), vv));
+            alignas(32) std::uint64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + scalar::count(p + i, n - i, v);
+        }
+
+        DS_TARGET_AVX2 inline std::uint64_t min(const std::uint64_t* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::min(p, n);
+            __m256i m = load(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4){
+                __m256i x = load(p + i);
+                m = _mm256_blendv_epi8(m, x, gt_u64(m, x));
+            }
+            alignas(32) std::uint64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+            std::uint64_t r = scalar::min(lanes, 4);
+            return i < n ? (scalar::min(p + i, n - i) < r ? scalar::min(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline std::uint64_t max(const std::uint64_t* p, std::size_t n) noexcept{
+            if(n < 4) return scalar::max(p, n);
+            __m256i m = load(p);
+            std::size_t i = 4;
+            for(; i + 4 <= n; i += 4){
+                __m256i x = load(p + i);
+                m = _mm256_blendv_epi8(m, x, gt_u64(x, m));
+            }
+            alignas(32) std::uint64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+            std::uint64_t r = scalar::max(lanes, 4);
+            return i < n ? (r < scalar::max(p + i, n - i) ? scalar::max(p + i, n - i) : r) : r;
+        }
+
+        DS_TARGET_AVX2 inline unsigned long long sum(const std::uint64_t* p, std::size_t n) noexcept{
+            __m256i acc = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4) acc = _mm256_add_epi64(acc, load(p + i));
+            alignas(32) std::uint64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(p + i, n - i);
+        }
+
+    } // namespace avx2
+
+#endif // DS_SIMD_X86
+
+    namespace detail{
+
+        template <typename T>
+        constexpr bool has_kernels = std::is_same<T, std::int32_t>::value ||
+                                     std::is_same<T, float>::value ||
+                                     std::is_same<T, std::uint64_t>::value;
+
+// Routes a call to the active ISA's kernel for the types that have one.
+#if defined(DS_SIMD_X86)
+#define DS_SIMD_DISPATCH(fn, ...)                                              \
+        if constexpr (detail::has_kernels<T>){                                 \
+            switch(active_isa()){                                              \
+                case Isa::avx2: return avx2::fn(__VA_ARGS__);                  \
+                case Isa::sse2: return sse2::fn(__VA_ARGS__);                  \
+                default: break;                                                \
+            }                                                                  \
+        }                                                                      \
+        return scalar::fn(__VA_ARGS__)
+#else
+#define DS_SIMD_DISPATCH(fn, ...) return scalar::fn(__VA_ARGS__)
+#endif
+
+    } // namespace detail
+
+    // pointer-range entry points
+
+    template <typename T>
+    std::size_t find(const T* p, std::size_t n, T value) noexcept{
+        static_assert(std::is_arithmetic<T>::value, "simd kernels need an arithmetic type");
+        DS_SIMD_DISPATCH(find, p, n, value);
+    }
+
+    template <typename T>
+    std::size_t count(const T* p, std::size_t n, T value) noexcept{
+        static_assert(std::is_arithmetic<T>::value, "simd kernels need an arithmetic type");
+        DS_SIMD_DISPATCH(count, p, n, value);
+    }
+
+    template <typename T>
+    T min(const T* p, std::size_t n) noexcept{
+        static_assert(std::is_arithmetic<T>::value, "simd kernels need an arithmetic type");
+        assert(n > 0 && "min of empty range");
+        DS_SIMD_DISPATCH(min, p, n);
+    }
+
+    template <typename T>
+    T max(const T* p, std::size_t n) noexcept{
+        static_assert(std::is_arithmetic<T>::value, "simd kernels need an arithmetic type");
+        assert(n > 0 && "max of empty range");
+        DS_SIMD_DISPATCH(max, p, n);
+    }
+
+    template <typename T>
+    sum_t<T> sum(const T* p, std::size_t n) noexcept{
+        static_assert(std::is_arithmetic<T>::value, "simd kernels need an arithmetic type");
+        DS_SIMD_DISPATCH(sum, p, n);
+    }
+
+#undef DS_SIMD_DISPATCH
+
+    // DynamicArray entry points
+
+    template <typename T, typename A, typename P>
+    std::size_t find(const DynamicArray<T, A, P>& arr, const typename DynamicArray<T, A, P>::value_type& value) noexcept{
+        return find(arr.data(), arr.size(), value);
+    }
+
+    template <typename T, typename A, typename P>
+    std::size_t count(const DynamicArray<T, A, P>& arr, const typename DynamicArray<T, A, P>::value_type& value) noexcept{
+        return count(arr.data(), arr.size(), value);
+    }
+
+    template <typename T, typename A, typename P>
+    T min(const DynamicArray<T, A, P>& arr) noexcept { return min(arr.data(), arr.size()); }
+
+    template <typename T, typename A, typename P>
+    T max(const DynamicArray<T, A, P>& arr) noexcept { return max(arr.data(), arr.size()); }
+
+    template <typename T, typename A, typename P>
+    sum_t<T> sum(const DynamicArray<T, A, P>& arr) noexcept { return sum(arr.data(), arr.size()); }
+
+} // namespace simd
+
+#endif /* SIMD_HPP */
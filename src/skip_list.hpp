@@ -0,0 +1,413 @@
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocators.hpp"
+
+namespace skip_detail{
+
+    // Node heights run from 1 to max_height; each level up is taken with
+    // probability 1/4, so a node has 4/3 links on average.
+    constexpr unsigned max_height = 32;
+
+    // how a stored value yields its key: sets store the key itself, maps a
+    // std::pair whose first is the key
+    struct Identity{
+        template <typename T>
+        const T& operator()(const T& v) const noexcept { return v; }
+    };
+
+    struct First{
+        template <typename P>
+        const typename P::first_type& operator()(const P& p) const noexcept { return p.first; }
+    };
+
+    // xorshift64*: cheap, and good enough to pick node heights
+    class HeightGenerator{
+    public:
+        explicit HeightGenerator(std::uint64_t seed = 0x9E3779B97F4A7C15ull) noexcept : state_(seed | 1) {}
+
+        unsigned next() noexcept{
+            state_ ^= state_ >> 12;
+            state_ ^= state_ << 25;
+            state_ ^= state_ >> 27;
+            std::uint64_t r = state_ * 0x2545F4914F6CDD1Dull;
+            unsigned height = 1;
+            while(height < max_height && (r & 3) == 0){
+                ++height;
+                r >>= 2;
+            }
+            return height;
+        }
+
+    private:
+        std::uint64_t state_;
+    };
+
+    // One lazily sized PoolResource per node height, so a node takes room
+    // for exactly its own links. Slabs shrink with the height's frequency.
+    class HeightPools{
+    public:
+        HeightPools() = default;
+        HeightPools(const HeightPools&) = delete;
+        HeightPools& operator=(const HeightPools&) = delete;
+
+        void* allocate(unsigned height, std::size_t bytes, std::size_t align){
+            std::unique_ptr<PoolResource>& pool = pools_[height - 1];
+            if(!pool){
+                unsigned shift = 2 * (height - 1);
+                std::size_t per_slab = shift < 6 ? std::size_t(256) >> shift : 4;
+                pool.reset(new PoolResource(0, per_slab));
+            }
+            return pool->allocate(bytes, align);
+        }
+
+        void deallocate(void* p, unsigned height, std::size_t bytes, std::size_t align) noexcept{
+            pools_[height - 1]->deallocate(p, bytes, align);
+        }
+
+    private:
+        std::unique_ptr<PoolResource> pools_[max_height];
+    };
+
+} // namespace skip_detail
+
+// Ordered set or map as a skip list: every element sits on level 0, a linked
+// list in key order, and on each level above with probability 1/4, so a
+// search skips ahead on the high levels and drops down. insert, find and
+// erase take O(log n) expected time; iteration walks level 0 in order.
+//
+// A node is allocated with exactly as many links as its height, from a pool
+// per height (see skip_detail::HeightPools): most nodes carry one link, not
+// room for max_height of them.
+//
+// Use the aliases:
+//
+//     SkipListMap<std::string, int> m;
+//     m.insert({"b", 2});
+//     m.emplace("a", 1);
+//     for(auto it = m.lower_bound("a"); it != m.upper_bound("c"); ++it) ...
+//     SkipListSet<long> s;
+//
+// Keys are unique. Iterators and references stay valid until their element
+// is erased.
+template <typename Value, typename Key, typename KeyOf, typename Compare = std::less<Key>>
+class SkipList{
+    struct Node{
+        alignas(Value) unsigned char storage[sizeof(Value)];
+        unsigned height;
+
+        explicit Node(unsigned h) noexcept : height(h) {}
+
+        Value* value() noexcept { return std::launder(reinterpret_cast<Value*>(storage)); }
+        const Value* value() const noexcept { return std::launder(reinterpret_cast<const Value*>(storage)); }
+        // the height links follow the node in the same block
+        Node** links() noexcept { return reinterpret_cast<Node**>(reinterpret_cast<unsigned char*>(this) + links_offset); }
+        Node* const* links() const noexcept { return reinterpret_cast<Node* const*>(reinterpret_cast<const unsigned char*>(this) + links_offset); }
+        Node* next() const noexcept { return links()[0]; }
+    };
+
+    static constexpr std::size_t links_offset = alloc_detail::align_up(sizeof(Node), alignof(Node*));
+    static constexpr std::size_t node_align = alignof(Node) > alignof(Node*) ? alignof(Node) : alignof(Node*);
+
+    template <bool Const>
+    class Iterator{
+        friend class SkipList;
+        using node_ptr = std::conditional_t<Const, const Node*, Node*>;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Value;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const Value*, Value*>;
+        using reference         = std::conditional_t<Const, const Value&, Value&>;
+
+        Iterator() noexcept : node_(nullptr) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& it) noexcept : node_(it.node_) {}
+
+        reference operator*()  const { return *node_->value(); }
+        pointer   operator->() const { return node_->value(); }
+
+        Iterator& operator++(){
+            node_ = node_->next();
+            return *this;
+        }
+        Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const Iterator& other) const { return node_ == other.node_; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class Iterator<!Const>;
+        explicit Iterator(node_ptr node) noexcept : node_(node) {}
+        node_ptr node_;
+    };
+
+public:
+    using key_type       = Key;
+    using value_type     = Value;
+    using size_type      = std::size_t;
+    using key_compare    = Compare;
+    using const_iterator = Iterator<true>;
+    // a set's elements are its keys: they cannot be changed in place
+    using iterator       = std::conditional_t<std::is_same<KeyOf, skip_detail::Identity>::value,
+                                              const_iterator, Iterator<false>>;
+
+    explicit SkipList(const Compare& comp = Compare()) : comp_(comp), head_{}, height_(1), size_(0) {}
+
+    ~SkipList(){ clear(); }
+
+    // Copies append in order at every level, in O(n).
+    SkipList(const SkipList& other)
+        : comp_(other.comp_), head_{}, height_(1), size_(0)
+    {
+        try{
+            Node** last[skip_detail::max_height];
+            for(unsigned l = 0; l < skip_detail::max_height; ++l) last[l] = head_;
+            for(const Value& v : other){
+                Node* n = create_node(rng_.next(), v);
+                for(unsigned l = 0; l < n -> height; ++l){
+                    last[l][l] = n;
+                    last[l] = n -> links();
+                }
+                if(n -> height > height_) height_ = n -> height;
+                ++size_;
+            }
+        }
+        catch(...){
+            clear();
+            throw;
+        }
+    }
+
+    // The moved-from list is left empty.
+    SkipList(SkipList&& other) noexcept
+        : comp_(other.comp_), rng_(other.rng_), pools_(std::move(other.pools_)),
+          height_(other.height_), size_(other.size_)
+    {
+        for(unsigned l = 0; l < skip_detail::max_height; ++l){
+            head_[l] = other.head_[l];
+            other.head_[l] = nullptr;
+        }
+        other.height_ = 1;
+        other.size_ = 0;
+    }
+
+    SkipList& operator=(SkipList other) noexcept{
+        swap(other);
+        return *this;
+    }
+
+    void swap(SkipList& other) noexcept{
+        using std::swap;
+        swap(comp_, other.comp_);
+        swap(rng_, other.rng_);
+        swap(pools_, other.pools_);
+        for(unsigned l = 0; l < skip_detail::max_height; ++l) swap(head_[l], other.head_[l]);
+        swap(height_, other.height_);
+        swap(size_, other.size_);
+    }
+
+    bool empty() const noexcept {return size_ == 0;}
+    size_type size() const noexcept {return size_;}
+
+    iterator begin() noexcept { return iterator(first()); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(first()); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+    // first element not less than key
+    iterator lower_bound(const Key& key) { return iterator(lower_node(key)); }
+    const_iterator lower_bound(const Key& key) const { return const_iterator(lower_node(key)); }
+
+    // first element greater than key
+    iterator upper_bound(const Key& key) { return iterator(upper_node(key)); }
+    const_iterator upper_bound(const Key& key) const { return const_iterator(upper_node(key)); }
+
+    iterator find(const Key& key) { return iterator(find_node(key)); }
+    const_iterator find(const Key& key) const { return const_iterator(find_node(key)); }
+
+    bool contains(const Key& key) const { return find_node(key) != nullptr; }
+
+    // Inserts value unless its key is present; returns the element with
+    // that key and whether it was inserted.
+    std::pair<iterator, bool> insert(const Value& value){
+        return insert_value(value);
+    }
+
+    std::pair<iterator, bool> insert(Value&& value){
+        return insert_value(std::move(value));
+    }
+
+    // Builds the value first, then drops it if its key is present.
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args){
+        Node* n = create_node(rng_.next(), std::forward<Args>(args)...);
+        Node** preds[skip_detail::max_height];
+        Node* found = search(key_of(n), preds);
+        if(found){
+            destroy_node(n);
+            return {iterator(found), false};
+        }
+        link(n, preds);
+        return {iterator(n), true};
+    }
+
+    // Returns how many elements were erased (0 or 1).
+    size_type erase(const Key& key){
+        Node** preds[skip_detail::max_height];
+        Node* n = search(key, preds);
+        if(!n) return 0;
+        unlink(n, preds);
+        return 1;
+    }
+
+    // Erases the element at pos (found again by its key, O(log n)) and
+    // returns the iterator after it.
+    iterator erase(const_iterator pos){
+        assert(pos.node_ && "erase of end()");
+        Node* next = const_cast<Node*>(pos.node_) -> next();
+        erase(key_of(pos.node_));
+        return iterator(next);
+    }
+
+    void clear() noexcept{
+        Node* n = first();
+        while(n){
+            Node* next = n -> next();
+            destroy_node(n);
+            n = next;
+        }
+        for(Node*& link : head_) link = nullptr;
+        height_ = 1;
+        size_ = 0;
+    }
+
+    key_compare key_comp() const { return comp_; }
+
+private:
+    static const Key& key_of(const Node* n) noexcept { return KeyOf()(*n -> value()); }
+
+    static std::size_t node_bytes(unsigned height) noexcept{
+        return links_offset + height * sizeof(Node*);
+    }
+
+    Node* allocate_node(unsigned height){
+        if(!pools_) pools_.reset(new skip_detail::HeightPools());
+        void* p = pools_ -> allocate(height, node_bytes(height), node_align);
+        Node* n = ::new (p) Node(height);
+        for(unsigned l = 0; l < height; ++l) ::new (static_cast<void*>(n -> links() + l)) Node*(nullptr);
+        return n;
+    }
+
+    void free_node(Node* n) noexcept{
+        unsigned height = n -> height;
+        n -> ~Node();
+        pools_ -> deallocate(n, height, node_bytes(height), node_align);
+    }
+
+    template <typename... Args>
+    Node* create_node(unsigned height, Args&&... args){
+        Node* n = allocate_node(height);
+        try{
+            ::new (static_cast<void*>(n -> storage)) Value(std::forward<Args>(args)...);
+        }
+        catch(...){
+            free_node(n);
+            throw;
+        }
+        return n;
+    }
+
+    void destroy_node(Node* n) noexcept{
+        n -> value() -> ~Value();
+        free_node(n);
+    }
+
+    Node* first() const noexcept { return head_[0]; }
+
+    // The walks below move from links array to links array: the head's,
+    // then each node's. search fills preds[l] with the links of the last
+    // node on level l whose key is less than key, for every level in use,
+    // and returns the node with key or null.
+    Node* search(const Key& key, Node*** preds){
+        Node** x = head_;
+        for(unsigned l = height_; l-- > 0;){
+            for(Node* n = x[l]; n && comp_(key_of(n), key); n = x[l]) x = n -> links();
+            preds[l] = x;
+        }
+        Node* n = x[0];
+        return n && !comp_(key, key_of(n)) ? n : nullptr;
+    }
+
+    Node* lower_node(const Key& key) const{
+        Node* const* x = head_;
+        for(unsigned l = height_; l-- > 0;){
+            for(Node* n = x[l]; n && comp_(key_of(n), key); n = x[l]) x = n -> links();
+        }
+        return x[0];
+    }
+
+    Node* upper_node(const Key& key) const{
+        Node* const* x = head_;
+        for(unsigned l = height_; l-- > 0;){
+            for(Node* n = x[l]; n && !comp_(key, key_of(n)); n = x[l]) x = n -> links();
+        }
+        return x[0];
+    }
+
+    Node* find_node(const Key& key) const{
+        Node* n = lower_node(key);
+        return n && !comp_(key, key_of(n)) ? n : nullptr;
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_value(V&& value){
+        Node** preds[skip_detail::max_height];
+        if(Node* found = search(KeyOf()(value), preds)) return {iterator(found), false};
+        Node* n = create_node(rng_.next(), std::forward<V>(value));
+        link(n, preds);
+        return {iterator(n), true};
+    }
+
+    // links n after preds; levels above the current height start at the head
+    void link(Node* n, Node*** preds) noexcept{
+        for(unsigned l = height_; l < n -> height; ++l) preds[l] = head_;
+        if(n -> height > height_) height_ = n -> height;
+        for(unsigned l = 0; l < n -> height; ++l){
+            n -> links()[l] = preds[l][l];
+            preds[l][l] = n;
+        }
+        ++size_;
+    }
+
+    void unlink(Node* n, Node*** preds) noexcept{
+        for(unsigned l = 0; l < n -> height; ++l) preds[l][l] = n -> links()[l];
+        while(height_ > 1 && !head_[height_ - 1]) --height_;
+        destroy_node(n);
+        --size_;
+    }
+
+    Compare comp_;
+    skip_detail::HeightGenerator rng_;
+    std::unique_ptr<skip_detail::HeightPools> pools_;   // created on first insert
+    Node* head_[skip_detail::max_height];               // the head's links
+    unsigned height_;               // levels in use
+    size_type size_;
+};
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using SkipListMap = SkipList<std::pair<const Key, T>, Key, skip_detail::First, Compare>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using SkipListSet = SkipList<Key, Key, skip_detail::Identity, Compare>;
+
+#endif /* SKIP_LIST_HPP */
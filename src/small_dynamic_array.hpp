@@ -0,0 +1,290 @@
+#ifndef SMALL_DYNAMIC_ARRAY_HPP
+#define SMALL_DYNAMIC_ARRAY_HPP
+
+#include <memory>
+#include <cassert>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include "relocation.hpp"
+
+// DynamicArray with room for N elements inside the object itself.
+// The first N elements never touch the heap; the (N+1)-th push moves
+// everything to a heap buffer of 2N and growth doubles from there.
+// Same exception guarantees as DynamicArray: strong on growth and on insert,
+// except that an insert into spare room is only basic for T whose move may
+// throw.
+//
+// Unlike DynamicArray, moving a SmallDynamicArray whose elements are inline
+// moves the elements themselves, so pointers into it do not survive a move.
+template <typename T, std::size_t N>
+class SmallDynamicArray{
+    static_assert(N > 0, "SmallDynamicArray needs at least one inline slot");
+    using Allocator    = std::allocator<T>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    SmallDynamicArray() noexcept
+        :data_(inline_data()), size_(0), capacity_(N) {}
+
+    explicit SmallDynamicArray(size_type n, const T& value = T())
+        :SmallDynamicArray()
+    {
+        reserve(n);
+        for(; size_ < n; ++size_) alloc_traits::construct(alloc_, data_ + size_, value);
+    }
+
+    //copy ctor
+    SmallDynamicArray(const SmallDynamicArray& other)
+        :SmallDynamicArray()
+    {
+        reserve(other.size_);
+        for(; size_ < other.size_; ++size_) alloc_traits::construct(alloc_, data_ + size_, other.data_[size_]);
+    }
+
+    //move ctor: steals a heap buffer, relocates inline elements
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        :SmallDynamicArray()
+    {
+        take(other);
+    }
+
+    ~SmallDynamicArray(){
+        clear();
+        release_heap();
+    }
+
+    SmallDynamicArray& operator=(const SmallDynamicArray& other){
+        if(this == &other) return *this;
+        SmallDynamicArray temp(other);
+        clear();
+        release_heap();
+        take(temp);
+        return *this;
+    }
+
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value){
+        if(this == &other) return *this;
+        clear();
+        release_heap();
+        take(other);
+        return *this;
+    }
+
+    void reserve(size_type new_cap){
+        if(new_cap <= capacity_) return;
+        reallocate(new_cap);
+    }
+
+    // moves back into the inline buffer when the elements fit
+    void shrink_to_fit(){
+        if(is_inline() || size_ == capacity_) return;
+        if(size_ <= N){
+            T* heap = data_;
+            relocation::relocate_n(alloc_, heap, size_, inline_data());
+            alloc_traits::deallocate(alloc_, heap, capacity_);
+            data_ = inline_data();
+            capacity_ = N;
+            return;
+        }
+        reallocate(size_);
+    }
+
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool is_inline() const noexcept { return data_ == inline_data(); }
+    static constexpr size_type inline_capacity() noexcept { return N; }
+
+    void push_back(const T& value){
+        emplace_back(value);
+    }
+
+    void push_back(T&& value){
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args){
+        if(size_ < capacity_){
+            alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+            return;
+        }
+        // build the new element before relocating, so args may alias an element
+        size_type new_cap = capacity_ * 2;
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        try{
+            alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        try{
+            relocation::relocate_n(alloc_, data_, size_, new_data);
+        }
+        catch(...){
+            alloc_traits::destroy(alloc_, new_data + size_);
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_cap;
+        ++size_;
+    }
+
+    void pop_back(){
+        assert(size_ > 0 && "Pop back on empty SmallDynamicArray");
+        --size_;
+        alloc_traits::destroy(alloc_, data_ + size_);
+    }
+
+    void insert(size_type index, const T& value){
+        emplace_at(index, value);
+    }
+
+    void insert(size_type index, T&& value){
+        emplace_at(index, std::move(value));
+    }
+
+    void erase(size_type index){
+        assert(index < size_ && "Index out of bound");
+        relocation::erase_n(alloc_, data_, index, size_, 1);
+        --size_;
+    }
+
+    void clear() noexcept{
+        for(size_type i = 0; i < size_; ++i) alloc_traits::destroy(alloc_, data_ + i);
+        size_ = 0;
+    }
+
+    T& operator[](size_type index){
+        assert(index < size_ && "index out of bound");
+        return data_[index];
+    }
+
+    const T& operator[](size_type index) const {
+        assert(index < size_ && "index out of bound");
+        return data_[index];
+    }
+
+    T* begin() noexcept { return data_; }
+    T* end() noexcept { return data_ + size_; }
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+private:
+    Allocator alloc_;
+    T* data_;
+    size_type size_;
+    size_type capacity_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+
+    T* inline_data() noexcept { return reinterpret_cast<T*>(inline_); }
+    const T* inline_data() const noexcept { return reinterpret_cast<const T*>(inline_); }
+
+    void release_heap() noexcept{
+        if(!is_inline()){
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+    }
+
+    // Strong guarantee: on exception the array is left unchanged.
+    void reallocate(size_type new_cap){
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        try{
+            relocation::relocate_n(alloc_, data_, size_, new_data);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_cap;
+    }
+
+    // Takes other's elements; *this must be empty and inline.
+    void take(SmallDynamicArray& other){
+        if(other.is_inline()){
+            relocation::relocate_n(alloc_, other.data_, other.size_, data_);
+        }
+        else{
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    template <typename... Args>
+    void emplace_at(size_type index, Args&&... args){
+        assert(index <= size_);
+        if(size_ == capacity_){
+            grow_emplace_at(index, std::forward<Args>(args)...);
+            return;
+        }
+        // args may refer to an element the shift is about to move
+        T value(std::forward<Args>(args)...);
+        if constexpr (is_nothrow_relocatable_v<T>){
+            relocation::shift_right(alloc_, data_, index, size_, 1);
+            try{
+                // an opted-in trivially relocatable T may still throw here
+                alloc_traits::construct(alloc_, data_ + index, std::move(value));
+            }
+            catch(...){
+                relocation::shift_left(alloc_, data_, index, size_ + 1, 1);
+                throw;
+            }
+            ++size_;
+        }
+        else{
+            relocation::insert_by_assignment(alloc_, data_, index, size_, std::move(value));
+        }
+    }
+
+    // Builds the new element straight into a buffer of twice the capacity
+    // and relocates the rest around it, as emplace_back does: args may alias
+    // an element, and a failure leaves the array unchanged.
+    template <typename... Args>
+    void grow_emplace_at(size_type index, Args&&... args){
+        size_type new_cap = capacity_ * 2;
+        T* new_data = alloc_traits::allocate(alloc_, new_cap);
+        try{
+            alloc_traits::construct(alloc_, new_data + index, std::forward<Args>(args)...);
+        }
+        catch(...){
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        bool prefix_done = false;
+        try{
+            relocation::relocate_prepare_n(alloc_, data_, index, new_data);
+            prefix_done = true;
+            relocation::relocate_prepare_n(alloc_, data_ + index, size_ - index, new_data + index + 1);
+        }
+        catch(...){
+            if(prefix_done) relocation::relocate_abort_n(alloc_, new_data, index);
+            alloc_traits::destroy(alloc_, new_data + index);
+            alloc_traits::deallocate(alloc_, new_data, new_cap);
+            throw;
+        }
+        relocation::relocate_finish_n(alloc_, data_, size_);
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_cap;
+        ++size_;
+    }
+};
+
+#endif /* SMALL_DYNAMIC_ARRAY_HPP */
@@ -0,0 +1,174 @@
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include "dynamic_array.hpp"
+#include "thread_pool.hpp"
+
+// Sorting for DynamicArray.
+//
+// sorting::radix_sort is a stable LSD radix sort, one byte per pass, for
+// integer and floating-point keys: either the elements themselves or a key
+// extracted from each element (key-payload structs). Passes in which every
+// key has the same byte are skipped. It needs a second buffer of n elements;
+// pass a scratch DynamicArray to reuse one across calls.
+//
+// sorting::parallel_sort sorts with any comparator on a ThreadPool: each
+// thread std::sorts one chunk, then chunks are merged pairwise, in parallel,
+// until one remains. Not stable.
+//
+//     sorting::radix_sort(keys);
+//     sorting::radix_sort(records, scratch, [](const Record& r){ return r.key; });
+//     sorting::parallel_sort(pool, names);
+
+namespace sorting{
+
+    namespace detail{
+
+        template <std::size_t Bytes> struct unsigned_of;
+        template <> struct unsigned_of<1> { using type = std::uint8_t;  };
+        template <> struct unsigned_of<2> { using type = std::uint16_t; };
+        template <> struct unsigned_of<4> { using type = std::uint32_t; };
+        template <> struct unsigned_of<8> { using type = std::uint64_t; };
+
+        // Maps a key to an unsigned integer with the same ordering.
+        // Signed integers flip the sign bit; IEEE floats flip the sign bit of
+        // positives and every bit of negatives. -0.0 orders before +0.0 and
+        // NaNs go to the ends according to their sign bit.
+        template <typename K>
+        auto ordered_bits(K key) noexcept{
+            static_assert(std::is_arithmetic<K>::value, "radix_sort keys must be arithmetic");
+            using U = typename unsigned_of<sizeof(K)>::type;
+            constexpr U top = U(U(1) << (sizeof(U) * 8 - 1));
+            if constexpr (std::is_same<K, bool>::value){
+                return static_cast<U>(key);
+            }
+            else if constexpr (std::is_floating_point<K>::value){
+                U u;
+                std::memcpy(&u, &key, sizeof u);
+                return (u & top) ? U(~u) : U(u | top);
+            }
+            else if constexpr (std::is_signed<K>::value){
+                return U(static_cast<U>(key) ^ top);
+            }
+            else{
+                return static_cast<U>(key);
+            }
+        }
+
+        template <typename T, typename A, typename P>
+        void make_room(DynamicArray<T, A, P>& buf, std::size_t n){
+            if constexpr (std::is_trivially_default_constructible<T>::value) buf.resize_for_overwrite(n);
+            else buf.resize(n);
+        }
+
+    } // namespace detail
+
+    // Sorts arr by key(element) using scratch as the second buffer. scratch
+    // is resized to arr.size() and its contents are unspecified afterwards;
+    // arr and scratch may trade buffers.
+    template <typename T, typename A, typename P, typename KeyFn>
+    void radix_sort(DynamicArray<T, A, P>& arr, DynamicArray<T, A, P>& scratch, KeyFn key){
+        static_assert(std::is_trivially_copyable<T>::value, "radix_sort needs a trivially copyable type");
+        assert(&arr != &scratch && "scratch must be a different array");
+        using Bits = decltype(detail::ordered_bits(key(std::declval<const T&>())));
+        constexpr std::size_t passes = sizeof(Bits);
+        const std::size_t n = arr.size();
+        if(n < 2) return;
+
+        // one read pass builds the histograms of every byte
+        std::size_t counts[passes][256] = {};
+        for(std::size_t i = 0; i < n; ++i){
+            Bits b = detail::ordered_bits(key(arr[i]));
+            for(std::size_t p = 0; p < passes; ++p) ++counts[p][(b >> (8 * p)) & 0xff];
+        }
+
+        detail::make_room(scratch, n);
+        T* src = arr.data();
+        T* dst = scratch.data();
+        for(std::size_t p = 0; p < passes; ++p){
+            std::size_t* count = counts[p];
+            Bits first = detail::ordered_bits(key(src[0]));
+            if(count[(first >> (8 * p)) & 0xff] == n) continue;   // byte is the same everywhere
+            std::size_t offset[256];
+            std::size_t sum = 0;
+            for(std::size_t d = 0; d < 256; ++d){
+                offset[d] = sum;
+                sum += count[d];
+            }
+            for(std::size_t i = 0; i < n; ++i){
+                Bits b = detail::ordered_bits(key(src[i]));
+                dst[offset[(b >> (8 * p)) & 0xff]++] = src[i];
+            }
+            std::swap(src, dst);
+        }
+        if(src != arr.data()) arr.swap(scratch);
+    }
+
+    template <typename T, typename A, typename P>
+    void radix_sort(DynamicArray<T, A, P>& arr, DynamicArray<T, A, P>& scratch){
+        radix_sort(arr, scratch, [](const T& v){ return v; });
+    }
+
+    template <typename T, typename A, typename P, typename KeyFn,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<KeyFn>, DynamicArray<T, A, P>>::value>>
+    void radix_sort(DynamicArray<T, A, P>& arr, KeyFn key){
+        DynamicArray<T, A, P> scratch(arr.get_allocator());
+        radix_sort(arr, scratch, key);
+    }
+
+    template <typename T, typename A, typename P>
+    void radix_sort(DynamicArray<T, A, P>& arr){
+        DynamicArray<T, A, P> scratch(arr.get_allocator());
+        radix_sort(arr, scratch);
+    }
+
+    // Sorts [first, last) with comp on pool.
+    template <typename T, typename Compare = std::less<>>
+    void parallel_sort(ThreadPool& pool, T* first, T* last, Compare comp = Compare()){
+        const std::size_t n = static_cast<std::size_t>(last - first);
+        std::size_t chunks = pool.size();
+        // below a few thousand elements per chunk the fork-join costs more than it saves
+        constexpr std::size_t min_chunk = 4096;
+        if(chunks > n / min_chunk) chunks = n / min_chunk;
+        if(chunks < 2){
+            std::sort(first, last, comp);
+            return;
+        }
+
+        DynamicArray<std::size_t> bounds;
+        bounds.reserve(chunks + 1);
+        for(std::size_t c = 0; c <= chunks; ++c) bounds.push_back(n * c / chunks);
+
+        pool.run(chunks, [&](std::size_t c){
+            std::sort(first + bounds[c], first + bounds[c + 1], comp);
+        });
+
+        // merge neighbouring runs pairwise until one run is left
+        while(bounds.size() > 2){
+            std::size_t runs = bounds.size() - 1;
+            pool.run(runs / 2, [&](std::size_t j){
+                std::inplace_merge(first + bounds[2 * j], first + bounds[2 * j + 1],
+                                   first + bounds[2 * j + 2], comp);
+            });
+            DynamicArray<std::size_t> merged;
+            merged.reserve(runs / 2 + 2);
+            for(std::size_t i = 0; i < bounds.size(); i += 2) merged.push_back(bounds[i]);
+            if(merged[merged.size() - 1] != n) merged.push_back(n);
+            bounds.swap(merged);
+        }
+    }
+
+    template <typename T, typename A, typename P, typename Compare = std::less<>>
+    void parallel_sort(ThreadPool& pool, DynamicArray<T, A, P>& arr, Compare comp = Compare()){
+        parallel_sort(pool, arr.begin(), arr.end(), comp);
+    }
+
+} // namespace sorting
+
+#endif /* SORT_HPP */
@@ -0,0 +1,183 @@
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Bounded FIFO for exactly one producer thread and one consumer thread,
+// with no locks and no allocation after construction. The capacity is
+// rounded up to a power of two, so a slot is index & mask.
+//
+// head_ (next slot to pop) and tail_ (next slot to push) only ever grow and
+// each has a single writer. The producer owns tail_ and keeps a cached copy
+// of head_, rereading the shared head_ only when the cache says the buffer
+// is full; the consumer does the same with tail_. Each side's fields share a
+// cache line and the two sides sit on separate lines, so an operation
+// reads the other side's line only when its cached copy runs out.
+//
+// try_push_n and try_pop_n move a whole batch with one index update.
+//
+//     SpscRingBuffer<Msg> ring(1024);
+//     ring.try_push(m);                             // producer thread
+//     Msg batch[64];
+//     std::size_t k = ring.try_pop_n(batch, 64);    // consumer thread
+//
+// T's move assignment must not throw: try_pop_n destroys each slot as it
+// moves the element out and hands the slots back only at the end, so a
+// throw halfway would leave destroyed slots counted as filled. The same
+// goes for storing into try_pop_n's output iterator.
+template <typename T>
+class SpscRingBuffer{
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+                  "SpscRingBuffer needs a nothrow move assignment to pop");
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    explicit SpscRingBuffer(size_type capacity)
+        : mask_(round_up_pow2(capacity) - 1),
+          slots_(static_cast<T*>(::operator new((mask_ + 1) * sizeof(T), std::align_val_t(slot_align)))) {}
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    // must not run concurrently with either side
+    ~SpscRingBuffer(){
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        for(size_type i = consumer_.head.load(std::memory_order_relaxed); i != tail; ++i){
+            slots_[i & mask_].~T();
+        }
+        ::operator delete(slots_, std::align_val_t(slot_align));
+    }
+
+    size_type capacity() const noexcept { return mask_ + 1; }
+
+    // A snapshot: may be stale by the time the caller looks at it.
+    size_type size_approx() const noexcept{
+        size_type head = consumer_.head.load(std::memory_order_acquire);
+        size_type tail = producer_.tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty_approx() const noexcept { return size_approx() == 0; }
+
+    // --- producer side ---
+
+    bool try_push(const T& value){ return try_emplace(value); }
+    bool try_push(T&& value){ return try_emplace(std::move(value)); }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args){
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        if(free_slots(tail) == 0) return false;
+        ::new (static_cast<void*>(slots_ + (tail & mask_))) T(std::forward<Args>(args)...);
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pushes up to n elements from first, in order, and returns how many
+    // fit. The consumer sees the whole batch at once.
+    template <typename InputIt>
+    size_type try_push_n(InputIt first, size_type n){
+        size_type tail = producer_.tail.load(std::memory_order_relaxed);
+        size_type k = free_slots(tail, n);
+        if(k > n) k = n;
+        size_type i = 0;
+        try{
+            for(; i < k; ++i, ++first){
+                ::new (static_cast<void*>(slots_ + ((tail + i) & mask_))) T(*first);
+            }
+        }
+        catch(...){
+            for(size_type j = 0; j < i; ++j) slots_[(tail + j) & mask_].~T();
+            throw;
+        }
+        if(k) producer_.tail.store(tail + k, std::memory_order_release);
+        return k;
+    }
+
+    // --- consumer side ---
+
+    // Moves the oldest element into out and returns true, or returns false
+    // if the buffer was empty.
+    bool try_pop(T& out){
+        size_type head = consumer_.head.load(std::memory_order_relaxed);
+        if(filled_slots(head) == 0) return false;
+        T& slot = slots_[head & mask_];
+        out = std::move(slot);
+        slot.~T();
+        consumer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Moves up to max of the oldest elements, in order, to *out++ and
+    // returns how many. The producer gets all their slots back at once.
+    template <typename OutputIt>
+    size_type try_pop_n(OutputIt out, size_type max){
+        size_type head = consumer_.head.load(std::memory_order_relaxed);
+        size_type k = filled_slots(head, max);
+        if(k > max) k = max;
+        for(size_type i = 0; i < k; ++i, ++out){
+            T& slot = slots_[(head + i) & mask_];
+            *out = std::move(slot);
+            slot.~T();
+        }
+        if(k) consumer_.head.store(head + k, std::memory_order_release);
+        return k;
+    }
+
+private:
+    static constexpr size_type cache_line = 64;
+    static constexpr size_type slot_align = alignof(T) > cache_line ? alignof(T) : cache_line;
+
+    static size_type round_up_pow2(size_type n) noexcept{
+        assert(n > 0 && "SpscRingBuffer needs a capacity");
+        size_type p = 1;
+        while(p < n) p <<= 1;
+        return p;
+    }
+
+    // Free slots seen by the producer. The cached head is refreshed only
+    // when it cannot cover wanted slots.
+    size_type free_slots(size_type tail, size_type wanted = 1) noexcept{
+        size_type free = capacity() - (tail - producer_.cached_head);
+        if(free < wanted){
+            producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+            free = capacity() - (tail - producer_.cached_head);
+        }
+        return free;
+    }
+
+    // Filled slots seen by the consumer, refreshing the cached tail the
+    // same way.
+    size_type filled_slots(size_type head, size_type wanted = 1) noexcept{
+        size_type filled = consumer_.cached_tail - head;
+        if(filled < wanted){
+            consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+            filled = consumer_.cached_tail - head;
+        }
+        return filled;
+    }
+
+    struct alignas(cache_line) Producer{
+        std::atomic<size_type> tail{0};
+        size_type cached_head = 0;          // producer's last view of head
+    };
+
+    struct alignas(cache_line) Consumer{
+        std::atomic<size_type> head{0};
+        size_type cached_tail = 0;          // consumer's last view of tail
+    };
+
+    // read-only after construction; kept off both sides' lines
+    alignas(cache_line) const size_type mask_;
+    T* const slots_;
+    Producer producer_;
+    Consumer consumer_;
+};
+
+#endif /* SPSC_RING_BUFFER_HPP */
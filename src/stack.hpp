@@ -6,56 +6,81 @@
 #include <cstddef>
 #include <utility>
 
-template<typename T>
+// LIFO adaptor over DynamicArray. By default the capacity stays at its
+// high-water mark (RetainCapacityPolicy), so a stack that keeps swinging
+// between deep and shallow does not reallocate on the way down and up again;
+// call shrink_to_fit() to give the memory back. Pass DefaultGrowthPolicy to
+// shrink automatically instead.
+template<typename T, typename Allocator = std::allocator<T>, typename Policy = RetainCapacityPolicy>
 class Stack{
 public:
     using size_type = std::size_t;
-    Stack()
-        : size_(0) {}
-   
+    Stack() = default;
+
 
 bool isEmpty() const noexcept{
-    return size_ == 0;
+    return buffer_.empty();
 }
 
 void push(const T& value ){
     buffer_.push_back(value);
-    ++size_;
 }
 
 void push(T&& value){
     buffer_.push_back(std::move(value));
-    ++size_;
+}
+
+template <typename... Args>
+void emplace(Args&&... args){
+    buffer_.emplace_back(std::forward<Args>(args)...);
+}
+
+// pushes [first, last) in order, so *(last - 1) ends up on top
+template <typename InputIt>
+void push_n(InputIt first, InputIt last){
+    buffer_.append(first, last);
 }
 
 void pop(){
-    assert(size_ > 0 && "Pop on empty stack");
+    assert(!buffer_.empty() && "Pop on empty stack");
     buffer_.pop_back();
-    --size_;
+}
+
+// removes the top k elements
+void pop_n(size_type k){
+    assert(k <= buffer_.size() && "pop_n past the bottom of the stack");
+    buffer_.erase(buffer_.end() - k, buffer_.end());
 }
 
 T& top(){
-    assert(size_ > 0 && "Top on empty stack");
-    return buffer_[size_ - 1];
+    assert(!buffer_.empty() && "Top on empty stack");
+    return buffer_[buffer_.size() - 1];
 }
 
 const T& top() const {
-    assert(size_ > 0 && "Top on empty stack");
-    return buffer_[size_ - 1];
+    assert(!buffer_.empty() && "Top on empty stack");
+    return buffer_[buffer_.size() - 1];
 }
 
 void clear(){
     buffer_.clear();
-    size_ = 0 ;
 }
 
-size_type size() const noexcept{return size_;}
+void reserve(size_type n){
+    buffer_.reserve(n);
+}
+
+void shrink_to_fit(){
+    buffer_.shrink_to_fit();
+}
+
+size_type size() const noexcept{return buffer_.size();}
+size_type capacity() const noexcept{return buffer_.capacity();}
 
 private:
-    DynamicArray<T> buffer_;
-    size_type size_;
+    DynamicArray<T, Allocator, Policy> buffer_;
 
 };
 
 
-#endif /*STACK HPP*/
\ No newline at end of file
+#endif /*STACK HPP*/
@@ -0,0 +1,145 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "dynamic_array.hpp"
+
+// Minimal fork-join thread pool. run(tasks, fn) calls fn(i) for every i in
+// [0, tasks) on the workers and the calling thread, and returns once all of
+// them have finished. The first exception thrown by fn is rethrown from run.
+// One run() executes at a time; concurrent callers are serialized.
+class ThreadPool{
+public:
+    using size_type = std::size_t;
+
+    // threads counts the calling thread, so ThreadPool(1) runs everything inline.
+    explicit ThreadPool(size_type threads = default_threads())
+        : stop_(false), generation_(0), job_(nullptr)
+    {
+        if(threads == 0) threads = 1;
+        workers_.reserve(threads - 1);
+        for(size_type i = 0; i + 1 < threads; ++i){
+            workers_.emplace_back([this]{ worker_loop(); });
+        }
+    }
+
+    ~ThreadPool(){
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for(auto& t : workers_) t.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // number of threads that execute tasks, including the caller of run()
+    size_type size() const noexcept { return workers_.size() + 1; }
+
+    static size_type default_threads() noexcept{
+        unsigned n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+
+    template <typename F>
+    void run(size_type tasks, F&& fn){
+        if(tasks == 0) return;
+        std::lock_guard<std::mutex> serialize(run_mutex_);
+        using Fn = std::remove_reference_t<F>;
+        Job job(tasks, const_cast<void*>(static_cast<const void*>(&fn)),
+                [](void* f, size_type i){ (*static_cast<Fn*>(f))(i); });
+        if(workers_.empty() || tasks == 1){
+            for(size_type i = 0; i < tasks; ++i) fn(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            ++generation_;
+        }
+        wake_.notify_all();
+        work_on(job);
+        {
+            // wait for the tasks other threads claimed and for every worker to
+            // let go of the job before it leaves scope
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&]{ return job.remaining == 0 && job.attached == 0; });
+            job_ = nullptr;
+        }
+        if(job.error) std::rethrow_exception(job.error);
+    }
+
+private:
+    struct Job{
+        Job(size_type n, void* f, void (*call)(void*, size_type))
+            : tasks(n), fn(f), invoke(call), next(0), remaining(n), attached(0) {}
+        size_type tasks;
+        void* fn;
+        void (*invoke)(void*, size_type);
+        std::atomic<size_type> next;
+        size_type remaining;         // guarded by mutex_
+        size_type attached;          // workers inside work_on, guarded by mutex_
+        std::exception_ptr error;    // guarded by mutex_
+    };
+
+    DynamicArray<std::thread> workers_;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    bool stop_;
+    size_type generation_;
+    Job* job_;
+
+    void work_on(Job& job){
+        size_type finished = 0;
+        std::exception_ptr error;
+        for(;;){
+            size_type i = job.next.fetch_add(1, std::memory_order_relaxed);
+            if(i >= job.tasks) break;
+            try{
+                job.invoke(job.fn, i);
+            }
+            catch(...){
+                if(!error) error = std::current_exception();
+            }
+            ++finished;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        job.remaining -= finished;
+        if(error && !job.error) job.error = error;
+        if(job.remaining == 0) done_.notify_all();
+    }
+
+    void worker_loop(){
+        size_type seen = 0;
+        for(;;){
+            Job* job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&]{ return stop_ || (job_ && generation_ != seen); });
+                if(stop_) return;
+                seen = generation_;
+                job = job_;
+                ++job->attached;
+            }
+            work_on(*job);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --job->attached;
+                if(job->attached == 0) done_.notify_all();
+            }
+        }
+    }
+};
+
+#endif /* THREAD_POOL_HPP */
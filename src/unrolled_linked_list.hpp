@@ -0,0 +1,456 @@
+#ifndef UNROLLED_LINKED_LIST_HPP
+#define UNROLLED_LINKED_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "relocation.hpp"
+
+namespace unrolled_detail{
+
+    // about 256 bytes of elements per node, and never fewer than 4
+    template <typename T>
+    constexpr std::size_t default_node_capacity() noexcept{
+        return sizeof(T) * 4 >= 256 ? 4 : 256 / sizeof(T);
+    }
+
+} // namespace unrolled_detail
+
+// Doubly linked list of nodes that each hold up to B elements in a small
+// inline array, so walking it touches one cache line after another instead of
+// one node per element. A full node splits in half on insert; a node that
+// drops below half full on erase borrows from or merges with its successor.
+// Inserting or erasing at an iterator moves at most B elements; finding a
+// position by index walks nodes, not elements.
+//
+// Inserting may move elements of the node it lands in (and, on a split, of
+// the new neighbour), which invalidates iterators and references into those
+// two nodes; everything else stays put. Erase likewise touches the node and
+// its successor.
+template <typename T, std::size_t B = unrolled_detail::default_node_capacity<T>(),
+          typename Allocator = std::allocator<T>>
+class UnrolledLinkedList{
+    static_assert(B >= 2, "UnrolledLinkedList nodes need room for at least two elements");
+
+    struct Node{
+        Node* next;
+        Node* prev;
+        std::size_t count;
+        alignas(T) unsigned char storage[B * sizeof(T)];
+
+        Node() noexcept : next(nullptr), prev(nullptr), count(0) {}
+        T* data() noexcept { return reinterpret_cast<T*>(storage); }
+        const T* data() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits    = std::allocator_traits<node_allocator>;
+
+public:
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using allocator_type = Allocator;
+
+    static constexpr size_type node_capacity = B;
+
+class const_iterator;
+
+class iterator{
+    friend class UnrolledLinkedList;
+    friend class const_iterator;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    iterator() noexcept : node_(nullptr), pos_(0) {}
+
+    reference operator*()  const { return node_->data()[pos_]; }
+    pointer   operator->() const { return node_->data() + pos_; }
+
+    iterator& operator++(){
+        if(++pos_ == node_->count){ node_ = node_->next; pos_ = 0; }
+        return *this;
+    }
+    iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+
+    bool operator==(const iterator& other) const { return node_ == other.node_ && pos_ == other.pos_; }
+    bool operator!=(const iterator& other) const { return !(*this == other); }
+
+private:
+    iterator(Node* node, size_type pos) noexcept : node_(node), pos_(pos) {}
+    Node* node_;
+    size_type pos_;
+};
+
+class const_iterator{
+    friend class UnrolledLinkedList;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    const_iterator() noexcept : node_(nullptr), pos_(0) {}
+    const_iterator(const iterator& it) noexcept : node_(it.node_), pos_(it.pos_) {}
+
+    reference operator*()  const { return node_->data()[pos_]; }
+    pointer   operator->() const { return node_->data() + pos_; }
+
+    const_iterator& operator++(){
+        if(++pos_ == node_->count){ node_ = node_->next; pos_ = 0; }
+        return *this;
+    }
+    const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+
+    bool operator==(const const_iterator& other) const { return node_ == other.node_ && pos_ == other.pos_; }
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+private:
+    const_iterator(const Node* node, size_type pos) noexcept : node_(node), pos_(pos) {}
+    const Node* node_;
+    size_type pos_;
+};
+
+    UnrolledLinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0), nodes_(0) {}
+
+    explicit UnrolledLinkedList(const Allocator& alloc) noexcept
+        : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0), nodes_(0) {}
+
+    ~UnrolledLinkedList(){ clear(); }
+
+    UnrolledLinkedList(const UnrolledLinkedList& other)
+        : UnrolledLinkedList(other, node_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+    UnrolledLinkedList(const UnrolledLinkedList& other, const Allocator& alloc)
+        : UnrolledLinkedList(alloc)
+    {
+        try{
+            for(const T& value : other) push_back(value);
+        }
+        catch(...){
+            clear();
+            throw;
+        }
+    }
+
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : alloc_(std::move(other.alloc_)), head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)), size_(std::exchange(other.size_, 0)),
+          nodes_(std::exchange(other.nodes_, 0)) {}
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other){
+        if(this == &other) return *this;
+        // the copy is built with the allocator this list must end up with
+        constexpr bool propagate = node_traits::propagate_on_container_copy_assignment::value;
+        UnrolledLinkedList temp(other, propagate ? Allocator(other.alloc_) : Allocator(alloc_));
+        if constexpr (propagate) std::swap(alloc_, temp.alloc_);
+        swap_nodes(temp);
+        return *this;
+    }
+
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other)
+        noexcept(node_traits::propagate_on_container_move_assignment::value ||
+                 node_traits::is_always_equal::value)
+    {
+        if(this == &other) return *this;
+        clear();
+        if(!node_traits::propagate_on_container_move_assignment::value && !(alloc_ == other.alloc_)){
+            // our allocator cannot free other's nodes: move the elements over
+            for(T& value : other) push_back(std::move(value));
+            other.clear();
+            return *this;
+        }
+        if constexpr (node_traits::propagate_on_container_move_assignment::value){
+            alloc_ = std::move(other.alloc_);
+        }
+        swap_nodes(other);
+        return *this;
+    }
+
+    allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    // number of nodes; size() / node_count() is the average fill
+    size_type node_count() const noexcept { return nodes_; }
+
+    T& front(){
+        assert(size_ != 0 && "front() on empty list");
+        return head_->data()[0];
+    }
+    const T& front() const {
+        assert(size_ != 0 && "front() on empty list");
+        return head_->data()[0];
+    }
+    T& back(){
+        assert(size_ != 0 && "back() on empty list");
+        return tail_->data()[tail_->count - 1];
+    }
+    const T& back() const {
+        assert(size_ != 0 && "back() on empty list");
+        return tail_->data()[tail_->count - 1];
+    }
+
+    iterator begin() noexcept { return iterator(head_, 0); }
+    iterator end() noexcept { return iterator(nullptr, 0); }
+    const_iterator begin() const noexcept { return const_iterator(head_, 0); }
+    const_iterator end() const noexcept { return const_iterator(nullptr, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    void push_back(const T& value){ emplace_back(value); }
+    void push_back(T&& value){ emplace_back(std::move(value)); }
+
+    // fills the tail node before starting a new one, so a list built by
+    // push_back is packed B elements per node
+    template <typename... Args>
+    T& emplace_back(Args&&... args){
+        bool fresh = !tail_ || tail_->count == B;
+        Node* n = fresh ? link_node(tail_) : tail_;
+        try{
+            node_traits::construct(alloc_, n->data() + n->count, std::forward<Args>(args)...);
+        }
+        catch(...){
+            if(fresh) unlink_node(n);
+            throw;
+        }
+        ++n->count;
+        ++size_;
+        return n->data()[n->count - 1];
+    }
+
+    void push_front(const T& value){ emplace_front(value); }
+    void push_front(T&& value){ emplace_front(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args){
+        if(head_ && head_->count < B) return *emplace_in(head_, 0, std::forward<Args>(args)...);
+        Node* n = link_node(nullptr);
+        try{
+            node_traits::construct(alloc_, n->data(), std::forward<Args>(args)...);
+        }
+        catch(...){
+            unlink_node(n);
+            throw;
+        }
+        n->count = 1;
+        ++size_;
+        return n->data()[0];
+    }
+
+    void insert_at(size_type index, const T& value){ emplace_at(index, value); }
+    void insert_at(size_type index, T&& value){ emplace_at(index, std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_at(size_type index, Args&&... args){
+        assert(index <= size_ && "Index out of bound");
+        if(index == size_) return emplace_back(std::forward<Args>(args)...);
+        iterator it = locate(index);
+        return *emplace_in(it.node_, it.pos_, std::forward<Args>(args)...);
+    }
+
+    // Inserts before pos; moves at most B elements once pos is known.
+    iterator insert(const_iterator pos, const T& value){ return emplace(pos, value); }
+    iterator insert(const_iterator pos, T&& value){ return emplace(pos, std::move(value)); }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args){
+        if(!pos.node_){
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail_, tail_->count - 1);
+        }
+        return emplace_in(const_cast<Node*>(pos.node_), pos.pos_, std::forward<Args>(args)...);
+    }
+
+    // Erases the element at pos and returns an iterator to the one after it.
+    iterator erase(const_iterator pos){
+        assert(pos.node_ && "erase() at end()");
+        Node* n = const_cast<Node*>(pos.node_);
+        size_type i = pos.pos_;
+        relocation::erase_n(alloc_, n->data(), i, n->count, 1);
+        --n->count;
+        --size_;
+        if(n->count == 0){
+            Node* next = n->next;
+            unlink_node(n);
+            return iterator(next, 0);
+        }
+        rebalance(n);
+        if(i == n->count) return iterator(n->next, 0);
+        return iterator(n, i);
+    }
+
+    void erase_at(size_type index){
+        assert(index < size_ && "Index out of bound");
+        erase(locate(index));
+    }
+
+    void pop_front(){
+        assert(size_ != 0 && "pop_front() on empty list");
+        erase(begin());
+    }
+
+    void pop_back(){
+        assert(size_ != 0 && "pop_back() on empty list");
+        node_traits::destroy(alloc_, tail_->data() + tail_->count - 1);
+        --size_;
+        if(--tail_->count == 0) unlink_node(tail_);
+    }
+
+    void clear() noexcept{
+        Node* n = head_;
+        while(n){
+            Node* next = n->next;
+            for(size_type i = 0; i < n->count; ++i) node_traits::destroy(alloc_, n->data() + i);
+            node_traits::destroy(alloc_, n);
+            node_traits::deallocate(alloc_, n, 1);
+            n = next;
+        }
+        head_ = tail_ = nullptr;
+        size_ = 0;
+        nodes_ = 0;
+    }
+
+    // Iterator to element index; walks from whichever end is closer.
+    iterator locate(size_type index) noexcept{
+        assert(index <= size_ && "Index out of bound");
+        if(index == size_) return end();
+        if(index < size_ / 2){
+            Node* n = head_;
+            while(index >= n->count){ index -= n->count; n = n->next; }
+            return iterator(n, index);
+        }
+        size_type from_back = size_ - index;    // 1 = last element
+        Node* n = tail_;
+        while(from_back > n->count){ from_back -= n->count; n = n->prev; }
+        return iterator(n, n->count - from_back);
+    }
+
+private:
+    node_allocator alloc_;
+    Node* head_;
+    Node* tail_;
+    size_type size_;
+    size_type nodes_;
+
+    // inserting or erasing may relocate elements only where that cannot throw
+    // halfway, or where relocate_n can back out
+    static constexpr bool nothrow_relocate = is_nothrow_relocatable_v<T>;
+
+    void swap_nodes(UnrolledLinkedList& other) noexcept{
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        std::swap(nodes_, other.nodes_);
+    }
+
+    // new empty node after prev (at the front if prev is null)
+    Node* link_node(Node* prev){
+        Node* n = node_traits::allocate(alloc_, 1);
+        node_traits::construct(alloc_, n);
+        n->prev = prev;
+        n->next = prev ? prev->next : head_;
+        if(n->next) n->next->prev = n;
+        else tail_ = n;
+        if(prev) prev->next = n;
+        else head_ = n;
+        ++nodes_;
+        return n;
+    }
+
+    // frees a node whose elements are already gone
+    void unlink_node(Node* n) noexcept{
+        if(n->prev) n->prev->next = n->next;
+        else head_ = n->next;
+        if(n->next) n->next->prev = n->prev;
+        else tail_ = n->prev;
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+        --nodes_;
+    }
+
+    // Constructs a new element at position i of n (i <= n->count).
+    template <typename... Args>
+    iterator emplace_in(Node* n, size_type i, Args&&... args){
+        if(i == n->count && n->count < B){
+            node_traits::construct(alloc_, n->data() + i, std::forward<Args>(args)...);
+            ++n->count;
+            ++size_;
+            return iterator(n, i);
+        }
+        // args may refer to an element that the split or the shift moves
+        T value(std::forward<Args>(args)...);
+        if(n->count == B){
+            Node* m = link_node(n);
+            constexpr size_type half = B / 2;
+            try{
+                relocation::relocate_n(alloc_, n->data() + half, B - half, m->data());
+            }
+            catch(...){
+                unlink_node(m);
+                throw;
+            }
+            m->count = B - half;
+            n->count = half;
+            if(i > half){ n = m; i -= half; }
+        }
+        if constexpr (nothrow_relocate){
+            relocation::shift_right(alloc_, n->data(), i, n->count, 1);
+            try{
+                node_traits::construct(alloc_, n->data() + i, std::move(value));
+            }
+            catch(...){
+                relocation::shift_left(alloc_, n->data(), i, n->count + 1, 1);
+                throw;
+            }
+            ++n->count;
+        }
+        else{
+            // no raw gap: a throwing copy must not leave a hole in the node
+            size_type before = n->count;
+            try{
+                relocation::insert_by_assignment(alloc_, n->data(), i, n->count, std::move(value));
+            }
+            catch(...){
+                size_ += n->count - before;
+                throw;
+            }
+        }
+        ++size_;
+        return iterator(n, i);
+    }
+
+    // Keeps n at least half full by borrowing from, or merging with, its
+    // successor. Skipped for types whose relocation could throw.
+    void rebalance(Node* n) noexcept{
+        if constexpr (nothrow_relocate){
+            Node* m = n->next;
+            if(!m || n->count >= B / 2) return;
+            if(n->count + m->count <= B){
+                relocation::relocate_n(alloc_, m->data(), m->count, n->data() + n->count);
+                n->count += m->count;
+                m->count = 0;
+                unlink_node(m);
+            }
+            else{
+                size_type k = (m->count - n->count) / 2;
+                relocation::relocate_n(alloc_, m->data(), k, n->data() + n->count);
+                relocation::shift_left(alloc_, m->data(), 0, m->count, k);
+                n->count += k;
+                m->count -= k;
+            }
+        }
+        else{
+            (void)n;
+        }
+    }
+};
+
+#endif /* UNROLLED_LINKED_LIST_HPP */
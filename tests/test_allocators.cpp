@@ -0,0 +1,159 @@
+#include "../src/allocators.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+
+// Stateful allocator that never propagates: moving between two arrays with
+// different ids must fall back to moving element by element.
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    static int live;
+    int id;
+    explicit TaggedAllocator(int i = 0) : id(i) {}
+    template <typename U> TaggedAllocator(const TaggedAllocator<U>& o) : id(o.id) {}
+    T* allocate(std::size_t n) { ++live; return std::allocator<T>().allocate(n); }
+    void deallocate(T* p, std::size_t n) { --live; std::allocator<T>().deallocate(p, n); }
+};
+template <typename T> int TaggedAllocator<T>::live = 0;
+template <typename T, typename U>
+bool operator==(const TaggedAllocator<T>& a, const TaggedAllocator<U>& b) { return a.id == b.id; }
+template <typename T, typename U>
+bool operator!=(const TaggedAllocator<T>& a, const TaggedAllocator<U>& b) { return a.id != b.id; }
+
+int main(){
+    // arena: blocks are bump allocated and properly aligned
+    {
+        ArenaResource arena(256);
+        void* a = arena.allocate(3, 1);
+        void* b = arena.allocate(8, 8);
+        void* c = arena.allocate(1000, 64);           // bigger than a chunk
+        assert(a && b && c);
+        assert(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+        assert(reinterpret_cast<std::uintptr_t>(c) % 64 == 0);
+        arena.release();
+        void* d = arena.allocate(16);
+        assert(d != nullptr);
+    }
+
+    // DynamicArray on an arena
+    {
+        ArenaResource arena;
+        ArenaAllocator<int> alloc(arena);
+        DynamicArray<int, ArenaAllocator<int>> a(alloc);
+        for (int i = 0; i < 1000; ++i) a.push_back(i);
+        for (int i = 0; i < 1000; ++i) assert(a[i] == i);
+        a.erase(0);
+        a.insert(0, 42);
+        assert(a[0] == 42 && a.size() == 1000);
+        assert(a.get_allocator() == alloc);
+
+        DynamicArray<std::string, ArenaAllocator<std::string>> s(ArenaAllocator<std::string>{arena});
+        s.push_back("a long string that does not fit into the small string buffer");
+        s.emplace_back(3, 'x');
+        assert(s[1] == "xxx");
+    }
+
+    // pool: freed blocks are reused, oversize requests fall through
+    {
+        PoolResource pool(32, 4);
+        void* a = pool.allocate(32);
+        pool.deallocate(a, 32);
+        void* b = pool.allocate(16);
+        assert(a == b);
+        void* big = pool.allocate(4096);
+        pool.deallocate(big, 4096);
+        pool.deallocate(b, 16);
+        for (int i = 0; i < 10; ++i) pool.allocate(8);   // spans several slabs
+    }
+
+    // DynamicArray on a pool
+    {
+        PoolResource pool(64 * sizeof(int));
+        PoolAllocator<int> alloc(pool);
+        DynamicArray<int, PoolAllocator<int>> a(alloc);
+        for (int i = 0; i < 200; ++i) a.push_back(i);     // outgrows the block size
+        while (a.size() > 10) a.pop_back();               // shrinks back into pool blocks
+        for (int i = 0; i < 10; ++i) assert(a[i] == i);
+    }
+
+    // lazily sized pool: packed at the first request's size and alignment
+    {
+        PoolResource pool(0, 4);
+        assert(pool.block_size() == 0);
+        char* a = static_cast<char*>(pool.allocate(24, 8));
+        char* b = static_cast<char*>(pool.allocate(24, 8));
+        assert(pool.block_size() == 24 && b - a == 24);
+        void* wide = pool.allocate(24, 16);                // stride only guarantees 8
+        assert(reinterpret_cast<std::uintptr_t>(wide) % 16 == 0);
+        pool.deallocate(wide, 24, 16);
+        pool.deallocate(a, 24, 8);
+        assert(pool.allocate(24, 8) == a);
+        pool.deallocate(b, 24, 8);
+
+        NodePoolAllocator<long> x;
+        NodePoolAllocator<int> y(x);                       // rebinds share the pool
+        NodePoolAllocator<long> z;
+        assert(x == y && x != z);
+        long* p = x.allocate(1);
+        y.deallocate(reinterpret_cast<int*>(p), 1);
+        assert(reinterpret_cast<long*>(y.allocate(1)) == p);
+        int* arr = y.allocate(100);                        // arrays bypass the pool
+        assert(x.resource()->block_size() == sizeof(long));
+        y.deallocate(arr, 100);
+    }
+
+    // propagating allocators move and swap together with the buffer
+    {
+        ArenaResource r1, r2;
+        using Arr = DynamicArray<int, ArenaAllocator<int>>;
+        Arr a(ArenaAllocator<int>{r1});
+        Arr b(ArenaAllocator<int>{r2});
+        a.push_back(1);
+        b.push_back(2);
+        b.push_back(3);
+        a.swap(b);
+        assert(a.size() == 2 && a.get_allocator().resource() == &r2);
+        assert(b.size() == 1 && b.get_allocator().resource() == &r1);
+
+        b = std::move(a);
+        assert(b.size() == 2 && b[1] == 3 && b.get_allocator().resource() == &r2);
+
+        // copy assignment keeps the destination's resource
+        Arr c(ArenaAllocator<int>{r1});
+        c = b;
+        assert(c.size() == 2 && c.get_allocator().resource() == &r1);
+
+        // copy construction takes the source's allocator
+        Arr d(c);
+        assert(d.get_allocator().resource() == &r1 && d[0] == 2);
+    }
+
+    // non-propagating, unequal allocators: element-wise move
+    {
+        using Arr = DynamicArray<std::string, TaggedAllocator<std::string>>;
+        {
+            Arr a(TaggedAllocator<std::string>(1));
+            Arr b(TaggedAllocator<std::string>(2));
+            for (int i = 0; i < 10; ++i) a.push_back(std::to_string(i));
+            b.push_back("old");
+            b = std::move(a);
+            assert(b.get_allocator().id == 2);
+            assert(b.size() == 10 && b[9] == "9");
+            assert(a.size() == 0);
+
+            // equal allocators: the buffer itself is stolen
+            Arr c(TaggedAllocator<std::string>(2));
+            const std::string* buf = b.data();
+            c = std::move(b);
+            assert(c.data() == buf);
+        }
+        assert(TaggedAllocator<std::string>::live == 0);
+    }
+
+    std::cout << "Allocator tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "../src/array_file.hpp"
+#include <cassert>
+#include <iostream>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+struct Entry {
+    std::uint64_t key;
+    float weight;
+    std::uint16_t tag = 7;                 // not trivially default constructible
+};
+
+static std::string temp_path(const char* name) {
+    return std::string("/tmp/ds_test_array_file_") + name;
+}
+
+int main(){
+    // save + load round trip
+    {
+        std::string path = temp_path("ints.bin");
+        DynamicArray<int> a;
+        for (int i = 0; i < 10000; ++i) a.push_back(i * 3 - 7);
+        assert(array_file::save(a, path.c_str()));
+
+        DynamicArray<int> b;
+        b.push_back(99);
+        assert(array_file::load(b, path.c_str()));
+        assert(b.size() == a.size());
+        for (std::size_t i = 0; i < a.size(); ++i) assert(b[i] == a[i]);
+        std::remove(path.c_str());
+    }
+
+    // structs, and the mapped view over the same file
+    {
+        std::string path = temp_path("entries.bin");
+        DynamicArray<Entry> a;
+        for (std::uint64_t i = 0; i < 5000; ++i) a.push_back(Entry{i * i, i * 0.5f, std::uint16_t(i % 100)});
+        assert(array_file::save(a, path.c_str()));
+
+        DynamicArray<Entry> b;
+        assert(array_file::load(b, path.c_str()));
+        assert(b.size() == 5000 && b[4999].key == 4999ull * 4999 && b[42].tag == 42);
+
+        MappedArrayView<Entry> view(path.c_str());
+        assert(view.is_open() && view.size() == 5000);
+        assert(reinterpret_cast<std::uintptr_t>(view.data()) % alignof(Entry) == 0);
+        std::uint64_t sum = 0;
+        for (const Entry& e : view) sum += e.key;
+        std::uint64_t expect = 0;
+        for (const Entry& e : a) expect += e.key;
+        assert(sum == expect);
+        assert(view[123].weight == 61.5f);
+
+        MappedArrayView<Entry> moved(std::move(view));
+        assert(!view.is_open() && view.size() == 0);
+        assert(moved.is_open() && moved[1].key == 1);
+        moved.close();
+        assert(!moved.is_open() && moved.begin() == moved.end());
+        std::remove(path.c_str());
+    }
+
+    // empty arrays round trip
+    {
+        std::string path = temp_path("empty.bin");
+        DynamicArray<double> a;
+        assert(array_file::save(a, path.c_str()));
+        DynamicArray<double> b(5, 1.0);
+        assert(array_file::load(b, path.c_str()) && b.empty());
+        MappedArrayView<double> view(path.c_str());
+        assert(view.is_open() && view.empty());
+        std::remove(path.c_str());
+    }
+
+    // mismatched type, truncation and missing files are rejected without side effects
+    {
+        std::string path = temp_path("u32.bin");
+        DynamicArray<std::uint32_t> a(100, 5u);
+        assert(array_file::save(a, path.c_str()));
+
+        DynamicArray<std::uint64_t> wrong(3, 1ull);
+        assert(!array_file::load(wrong, path.c_str()));
+        assert(wrong.size() == 3 && wrong[0] == 1);
+        MappedArrayView<std::uint64_t> wrong_view(path.c_str());
+        assert(!wrong_view.is_open());
+
+        // chop off the last element
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        DynamicArray<char> bytes(64 + 99 * 4, 0);
+        assert(std::fread(bytes.data(), 1, bytes.size(), f) == bytes.size());
+        std::fclose(f);
+        f = std::fopen(path.c_str(), "wb");
+        std::fwrite(bytes.data(), 1, bytes.size(), f);
+        std::fclose(f);
+        DynamicArray<std::uint32_t> c;
+        assert(!array_file::load(c, path.c_str()) && c.empty());
+        assert(!MappedArrayView<std::uint32_t>(path.c_str()).is_open());
+        std::remove(path.c_str());
+
+        assert(!array_file::load(c, "/nonexistent/dir/file.bin"));
+        assert(!array_file::save(a, "/nonexistent/dir/file.bin"));
+        assert(!MappedArrayView<std::uint32_t>("/nonexistent/dir/file.bin").is_open());
+    }
+
+    std::cout << "Array file tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "../src/compact_list.hpp"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+template <typename T>
+static std::vector<T> items(const CompactList<T>& l){
+    std::vector<T> out;
+    for(const T& x : l) out.push_back(x);
+    return out;
+}
+
+int main(){
+    // push, pop and erase by handle, with neighbours kept linked
+    {
+        CompactList<int> l;
+        assert(l.empty() && l.head() == l.npos && l.tail() == l.npos && l.begin() == l.end());
+        auto a = l.push_back(1);
+        auto b = l.push_back(2);
+        auto z = l.push_front(0);
+        auto c = l.emplace_back(3);
+        assert(items(l) == (std::vector<int>{0, 1, 2, 3}));
+        assert(l.head() == z && l.tail() == c && l.front() == 0 && l.back() == 3);
+        assert(l.next(a) == b && l.prev(b) == a && l.prev(z) == l.npos && l.next(c) == l.npos);
+        assert(l.erase(b) == c);
+        assert(items(l) == (std::vector<int>{0, 1, 3}) && l.size() == 3 && l.slots() == 4);
+        auto d = l.emplace(c, 2);                       // reuses b's slot
+        assert(d == b && l.slots() == 4 && l[d] == 2);
+        assert(items(l) == (std::vector<int>{0, 1, 2, 3}));
+        l.pop_front();
+        l.pop_back();
+        assert(items(l) == (std::vector<int>{1, 2}) && l.head() == a && l.tail() == d);
+        l.pop_back();
+        l.pop_back();
+        assert(l.empty() && l.head() == l.npos && l.tail() == l.npos);
+        for(int i = 0; i < 4; ++i) l.push_back(i);      // all four slots reused
+        assert(l.slots() == 4 && items(l) == (std::vector<int>{0, 1, 2, 3}));
+    }
+
+    // erase through iterators, and pushing a reference into the list itself
+    {
+        CompactList<int> l;
+        for(int i = 0; i < 10; ++i) l.push_back(i);
+        for(auto it = l.begin(); it != l.end();){
+            if(*it % 3 == 0) it = l.erase(it);
+            else ++it;
+        }
+        assert(items(l) == (std::vector<int>{1, 2, 4, 5, 7, 8}));
+        CompactList<std::string> s;
+        s.push_back("a string too long for the small buffer");
+        for(int i = 0; i < 20; ++i) s.push_back(s.front());
+        for(const std::string& x : s) assert(x == "a string too long for the small buffer");
+    }
+
+    // compact puts the slots in list order and drops the free ones
+    {
+        CompactList<std::string> l;
+        for(int i = 0; i < 100; ++i) l.push_front(std::to_string(i));
+        for(auto h = l.head(); h != l.npos;){
+            auto next = l.next(h);
+            if(std::stoi(l[h]) % 2) l.erase(h);
+            h = next;
+        }
+        assert(l.size() == 50 && l.slots() == 100);
+        auto before = items(l);
+        l.compact();
+        assert(items(l) == before && l.slots() == 50 && l.capacity() == 50);
+        for(CompactList<std::string>::index_type i = 0; i < 50; ++i){
+            assert(l[i] == std::to_string(98 - 2 * i));
+            assert(l.next(i) == (i == 49 ? l.npos : i + 1));
+        }
+        l.push_back("x");
+        assert(l.back() == "x" && l.size() == 51);
+        CompactList<std::string> e;
+        e.compact();
+        assert(e.empty() && e.head() == e.npos);
+    }
+
+    // copies keep handles; moves leave the source empty; non-trivial values
+    // in live slots are destroyed exactly once
+    {
+        auto counter = std::make_shared<int>(0);
+        CompactList<std::shared_ptr<int>> l;
+        std::vector<CompactList<std::shared_ptr<int>>::index_type> hs;
+        for(int i = 0; i < 20; ++i) hs.push_back(l.push_back(counter));
+        for(int i = 0; i < 20; i += 2) l.erase(hs[i]);
+        assert(counter.use_count() == 11);
+        CompactList<std::shared_ptr<int>> c(l);
+        assert(counter.use_count() == 21 && c.size() == 10 && c[hs[1]] == counter);
+        CompactList<std::shared_ptr<int>> m(std::move(c));
+        assert(c.empty() && c.begin() == c.end() && m.size() == 10);
+        c = m;
+        m.clear();
+        assert(counter.use_count() == 21 && m.empty());
+        c = std::move(l);
+        assert(counter.use_count() == 11 && l.empty());
+        c.push_back(counter);                           // reuses a free slot
+        assert(c.slots() == 20 && counter.use_count() == 12);
+    }
+
+    std::cout << "CompactList tests passed.\n";
+    return 0;
+}
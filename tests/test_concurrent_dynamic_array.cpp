@@ -0,0 +1,90 @@
+#include "../src/concurrent_dynamic_array.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+struct ThrowsOn13 {
+    int v;
+    explicit ThrowsOn13(int x) : v(x) { if (x == 13) throw std::runtime_error("13"); }
+};
+
+int main(){
+    // single-threaded: indices, segment boundaries, stable addresses
+    {
+        ConcurrentDynamicArray<int> a;
+        assert(a.empty());
+        assert(a.push_back(7) == 0);
+        int* first = &a[0];
+        for (int i = 1; i < 10000; ++i) assert(a.push_back(i * 2) == static_cast<std::size_t>(i));
+        assert(a.size() == 10000);
+        assert(&a[0] == first && *first == 7);
+        for (int i = 1; i < 10000; ++i) assert(a[i] == i * 2 && a.is_ready(i));
+        assert(!a.is_ready(10000));
+        // neighbours within a segment are contiguous
+        assert(&a[15] == &a[0] + 15);
+        assert(&a[16 + 31] == &a[16] + 31);
+    }
+
+    // non-trivial elements are destroyed exactly once (ASan checks the leak side)
+    {
+        ConcurrentDynamicArray<std::string> a;
+        a.reserve(100);
+        for (int i = 0; i < 1000; ++i) a.emplace_back(std::to_string(i) + " a string too long for SSO");
+        assert(a[999].compare(0, 4, "999 ") == 0);
+    }
+
+    // a throwing constructor leaves an empty slot behind
+    {
+        ConcurrentDynamicArray<ThrowsOn13> a;
+        bool caught = false;
+        for (int i = 0; i < 20; ++i) {
+            try { a.emplace_back(i); } catch (const std::runtime_error&) { caught = true; }
+        }
+        assert(caught && a.size() == 20);
+        assert(!a.is_ready(13) && a.is_ready(14) && a[14].v == 14);
+    }
+
+    // many writers: every value lands exactly once, addresses never move
+    {
+        const int threads = 8, per_thread = 20000;
+        ConcurrentDynamicArray<long> a;
+        a.push_back(-1);
+        const long* anchor = &a[0];
+        std::atomic<bool> stop{false};
+        std::atomic<long> seen_ready{0};
+        // a reader polls is_ready while the writers run
+        std::thread reader([&]{
+            while (!stop.load()) {
+                std::size_t n = a.size();
+                for (std::size_t i = 0; i < n; i += 97) {
+                    if (a.is_ready(i)) { assert(a[i] >= -1); seen_ready.fetch_add(1, std::memory_order_relaxed); }
+                }
+            }
+        });
+        DynamicArray<std::thread> writers;
+        for (int t = 0; t < threads; ++t) {
+            writers.emplace_back([&a, t]{
+                for (int i = 0; i < per_thread; ++i) a.push_back(static_cast<long>(t) * per_thread + i);
+            });
+        }
+        for (auto& w : writers) w.join();
+        stop = true;
+        reader.join();
+
+        assert(a.size() == 1 + static_cast<std::size_t>(threads) * per_thread);
+        assert(&a[0] == anchor);
+        DynamicArray<char> hit(static_cast<std::size_t>(threads) * per_thread, 0);
+        for (std::size_t i = 1; i < a.size(); ++i) {
+            assert(a.is_ready(i));
+            assert(hit[a[i]] == 0);
+            hit[a[i]] = 1;
+        }
+    }
+
+    std::cout << "ConcurrentDynamicArray tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "../src/concurrent_queue.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+
+int main(){
+    // FIFO order on one thread, single and bulk
+    {
+        ConcurrentQueue<int> q;
+        assert(q.empty());
+        int out = 0;
+        assert(!q.try_dequeue(out));
+        for (int i = 0; i < 100; ++i) q.enqueue(i);
+        assert(!q.empty());
+        for (int i = 0; i < 10; ++i) {
+            assert(q.try_dequeue(out));
+            assert(out == i);
+        }
+        int batch[32];
+        assert(q.try_dequeue_bulk(batch, 0) == 0);
+        assert(q.try_dequeue_bulk(batch, 32) == 32);
+        for (int i = 0; i < 32; ++i) assert(batch[i] == 10 + i);
+        DynamicArray<int> rest;
+        assert(q.try_dequeue_bulk(std::back_inserter(rest), 1000) == 58);
+        for (int i = 0; i < 58; ++i) assert(rest[i] == 42 + i);
+        assert(q.empty() && q.try_dequeue_bulk(batch, 32) == 0);
+        q.enqueue(7);                                   // tail caught up with head
+        assert(q.try_dequeue(out) && out == 7);
+    }
+
+    // non-trivial values, and elements left behind are freed by the destructor
+    {
+        ConcurrentQueue<std::string> q;
+        q.emplace(40, 'x');
+        q.enqueue(std::string("long enough to live on the heap, not in SSO"));
+        q.enqueue("a third one, also longer than the small string buffer");
+        std::string out;
+        assert(q.try_dequeue(out) && out == std::string(40, 'x'));
+        std::string two[2];
+        assert(q.try_dequeue_bulk(two, 1) == 1 && two[0].size() > 15);
+        q.enqueue("left behind, also longer than the small string buffer");
+        q.enqueue("and another one left behind in the queue");
+    }
+
+    // producers and consumers (some bulk) concurrently: every value comes out
+    // exactly once, and each producer's values come out in order
+    {
+        const int producers = 4, consumers = 4, per_producer = 20000;
+        ConcurrentQueue<int> q;
+        std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[producers * per_producer]);
+        for (int i = 0; i < producers * per_producer; ++i) seen[i].store(0);
+        std::atomic<int> done{0};
+        std::atomic<bool> in_order{true};
+        DynamicArray<std::thread> workers;
+        for (int p = 0; p < producers; ++p) {
+            workers.emplace_back([&q, p]{
+                for (int i = 0; i < per_producer; ++i) q.enqueue(p * per_producer + i);
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            workers.emplace_back([&, c]{
+                int last[producers];
+                for (int& l : last) l = -1;
+                auto check = [&](int v){
+                    int p = v / per_producer;
+                    if (v <= last[p]) in_order.store(false);
+                    last[p] = v;
+                    seen[v].fetch_add(1);
+                    done.fetch_add(1);
+                };
+                int batch[16];
+                while (done.load() < producers * per_producer) {
+                    if (c % 2) {
+                        std::size_t k = q.try_dequeue_bulk(batch, 16);
+                        for (std::size_t i = 0; i < k; ++i) check(batch[i]);
+                    } else {
+                        int v;
+                        if (q.try_dequeue(v)) check(v);
+                    }
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        assert(in_order.load());
+        for (int i = 0; i < producers * per_producer; ++i) assert(seen[i].load() == 1);
+        assert(q.empty());
+        hazard::collect();
+    }
+
+    std::cout << "ConcurrentQueue tests passed.\n";
+    return 0;
+}
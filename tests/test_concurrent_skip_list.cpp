@@ -0,0 +1,153 @@
+#include "../src/concurrent_skip_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// counts copies, to see that inserting a present key builds nothing
+struct Copied {
+    static int copies;
+    int key;
+    Copied(int k) : key(k) {}
+    Copied(const Copied& o) : key(o.key) { ++copies; }
+    bool operator<(const Copied& o) const { return key < o.key; }
+};
+int Copied::copies = 0;
+
+int main(){
+    // single thread: set semantics, order and bounds
+    {
+        ConcurrentSkipListSet<int> s;
+        assert(s.empty() && s.begin() == s.end() && !s.contains(3));
+        for(int x : {5, 1, 9, 3, 7}) assert(s.insert(x));
+        assert(!s.insert(3) && s.size() == 5);
+        std::vector<int> in_order(s.begin(), s.end());
+        assert(in_order == (std::vector<int>{1, 3, 5, 7, 9}));
+        assert(*s.lower_bound(4) == 5 && s.lower_bound(10) == s.end());
+        assert(s.erase(5) && !s.erase(5) && !s.contains(5) && s.size() == 4);
+        assert(*s.lower_bound(4) == 7);
+        s.reclaim();
+        assert(s.insert(5) && s.contains(5));
+    }
+
+    // map: find returns the stored pair; erased values outlive the erase
+    {
+        ConcurrentSkipListMap<int, std::string> m;
+        assert(m.emplace(1, "one") && m.insert({2, "two"}));
+        assert(!m.emplace(1, "uno"));
+        const auto* e = m.find(1);
+        assert(e && e->second == "one" && !m.find(3));
+        assert(m.erase(1) && !m.find(1));
+        assert(e->second == "one");                     // kept until reclaim
+        m.reclaim();
+        assert(m.size() == 1 && m.begin()->first == 2);
+    }
+
+    // insert of a present key looks it up before building a node
+    {
+        ConcurrentSkipListSet<Copied> s;
+        Copied one(1);
+        assert(s.insert(one) && Copied::copies == 1);
+        assert(!s.insert(one) && !s.insert(Copied(1)) && Copied::copies == 1);
+        assert(s.insert(Copied(2)) && s.size() == 2);
+    }
+
+    // writers on disjoint and overlapping keys, with readers throughout
+    {
+        const int writers = 4, per_writer = 5000;
+        ConcurrentSkipListSet<int> s;
+        std::atomic<bool> stop{false};
+        std::atomic<bool> sorted{true};
+        std::atomic<int> inserted{0}, erased{0}, done_inserting{0};
+        DynamicArray<std::thread> threads;
+        for(int w = 0; w < writers; ++w){
+            threads.emplace_back([&, w]{
+                // every key in [0, writers * per_writer) is tried by two writers
+                for(int i = 0; i < per_writer; ++i){
+                    if(s.insert(w * per_writer + i)) inserted.fetch_add(1);
+                    if(s.insert(((w + 1) % writers) * per_writer + i)) inserted.fetch_add(1);
+                }
+                // once all have inserted, each erases the odd keys of its own range
+                done_inserting.fetch_add(1);
+                while(done_inserting.load() < writers) std::this_thread::yield();
+                for(int i = 1; i < per_writer; i += 2){
+                    if(s.erase(w * per_writer + i)) erased.fetch_add(1);
+                }
+            });
+        }
+        for(int r = 0; r < 2; ++r){
+            threads.emplace_back([&]{
+                while(!stop.load()){
+                    int last = -1;
+                    for(int x : s){
+                        if(x <= last) sorted.store(false);
+                        last = x;
+                    }
+                    for(int k = 0; k < writers * per_writer; k += 97) (void)s.contains(k);
+                }
+            });
+        }
+        for(int w = 0; w < writers; ++w) threads[w].join();
+        stop.store(true);
+        for(std::size_t t = writers; t < threads.size(); ++t) threads[t].join();
+        assert(sorted.load());
+        assert(inserted.load() == writers * per_writer);
+        assert(erased.load() == writers * per_writer / 2);
+        assert(s.size() == static_cast<std::size_t>(writers * per_writer / 2));
+        int expect = 0;
+        for(int x : s){
+            assert(x == expect);
+            expect += 2;
+        }
+        assert(expect == writers * per_writer);
+        s.reclaim();
+    }
+
+    // concurrent erase of the same keys: each succeeds exactly once
+    {
+        ConcurrentSkipListSet<int> s;
+        for(int i = 0; i < 10000; ++i) s.insert(i);
+        std::atomic<int> erased{0};
+        DynamicArray<std::thread> threads;
+        for(int t = 0; t < 4; ++t){
+            threads.emplace_back([&]{
+                for(int i = 0; i < 10000; ++i) if(s.erase(i)) erased.fetch_add(1);
+            });
+        }
+        for(auto& t : threads) t.join();
+        assert(erased.load() == 10000 && s.empty() && s.begin() == s.end());
+    }
+
+    // inserts and erases racing on a few keys leave a consistent list
+    {
+        ConcurrentSkipListSet<int> s;
+        std::atomic<long> net{0};
+        DynamicArray<std::thread> threads;
+        for(int t = 0; t < 4; ++t){
+            threads.emplace_back([&, t]{
+                unsigned r = 12345u + t;
+                for(int i = 0; i < 20000; ++i){
+                    r = r * 1103515245u + 12345u;
+                    int k = (r >> 16) % 32;
+                    if((r >> 8) & 1){ if(s.insert(k)) net.fetch_add(1); }
+                    else if(s.erase(k)) net.fetch_sub(1);
+                }
+            });
+        }
+        for(auto& t : threads) t.join();
+        long n = 0;
+        int last = -1;
+        for(int x : s){
+            assert(x > last && s.contains(x));
+            last = x;
+            ++n;
+        }
+        assert(n == net.load() && s.size() == static_cast<std::size_t>(n));
+    }
+
+    std::cout << "ConcurrentSkipList tests passed.\n";
+    return 0;
+}
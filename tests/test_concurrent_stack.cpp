@@ -0,0 +1,61 @@
+#include "../src/concurrent_stack.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+int main(){
+    // LIFO order on one thread
+    {
+        ConcurrentStack<int> s;
+        assert(s.empty());
+        int out = 0;
+        assert(!s.try_pop(out));
+        for (int i = 0; i < 100; ++i) s.push(i);
+        assert(!s.empty());
+        for (int i = 99; i >= 0; --i) {
+            assert(s.try_pop(out));
+            assert(out == i);
+        }
+        assert(!s.try_pop(out) && s.empty());
+    }
+
+    // non-trivial values, and elements left behind are freed by the destructor
+    {
+        ConcurrentStack<std::string> s;
+        s.emplace(40, 'x');
+        s.push(std::string("long enough to live on the heap, not in SSO"));
+        std::string out;
+        assert(s.try_pop(out) && out.size() > 15);
+        s.push("left behind, also longer than the small string buffer");
+    }
+
+    // many threads push and pop; every pushed value comes out exactly once
+    {
+        const int threads = 8, per_thread = 20000;
+        ConcurrentStack<int> s;
+        std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[threads * per_thread]);
+        for (int i = 0; i < threads * per_thread; ++i) seen[i].store(0);
+        DynamicArray<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&s, &seen, t]{
+                int out;
+                for (int i = 0; i < per_thread; ++i) {
+                    s.push(t * per_thread + i);
+                    if (i % 2 && s.try_pop(out)) seen[out].fetch_add(1);
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        int out;
+        while (s.try_pop(out)) seen[out].fetch_add(1);
+        for (int i = 0; i < threads * per_thread; ++i) assert(seen[i].load() == 1);
+        hazard::collect();
+    }
+
+    std::cout << "ConcurrentStack tests passed.\n";
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include "../src/doubly_linked_list.hpp"
+#include "../src/allocators.hpp"
 #include <cassert>
 #include <iostream>
+#include <string>
 
 
 int main(){
@@ -59,6 +61,52 @@ int main(){
 
     }
 
+    // pooled nodes: push/pop churn recycles the same blocks
+    {
+        DoublyLinkedList<std::string, NodePoolAllocator<std::string>> L;
+        for(int i = 0; i < 64; ++i) L.push_back(std::to_string(i));
+        auto* last = L.tail();
+        for(int round = 0; round < 100; ++round){
+            L.pop_back();
+            L.push_back("a string too long for the small buffer");
+            assert(L.tail() == last);
+        }
+        L.erase_at(10);
+        L.pop_front();
+        assert(L.size() == 62 && L.head() -> data == "1");
+        assert(L.get_allocator().resource() -> block_size() >= sizeof(std::string) + 2 * sizeof(void*));
+    }
+
+    // node handles: O(1) erase, move_to_front/back and splice between lists
+    {
+        DoublyLinkedList<int> L, M;
+        auto* a = L.emplace_back(1);
+        auto* b = L.emplace_back(2);
+        auto* c = L.emplace_back(3);
+        auto* z = L.emplace_front(0);
+        assert(L.head() == z && L.tail() == c && L.size() == 4);
+        L.move_to_front(c);                             // 3 0 1 2
+        assert(L.head() == c && c -> next == z && z -> prev == c && L.tail() == b);
+        L.move_to_front(c);
+        L.move_to_back(c);                              // 0 1 2 3
+        assert(L.tail() == c && b -> next == c && !c -> next && L.head() == z);
+        L.erase(a);                                     // 0 2 3
+        assert(L.size() == 3 && z -> next == b && b -> prev == z);
+        L.erase(z);
+        assert(L.head() == b && !b -> prev);
+        M.splice(nullptr, L, c);                        // L: 2  M: 3
+        assert(L.size() == 1 && L.tail() == b && !b -> next);
+        assert(M.size() == 1 && M.head() == c && M.tail() == c);
+        M.splice(c, L, b);                              // L: -  M: 2 3
+        assert(L.empty() && !L.head() && !L.tail());
+        assert(M.head() == b && b -> next == c && c -> prev == b && M.size() == 2);
+        M.erase(c);
+        M.erase(b);
+        assert(M.empty() && !M.head() && !M.tail());
+        const DoublyLinkedList<int>& cm = M;
+        assert(!cm.head() && !cm.tail());
+    }
+
     std::cout << "DoublyLinkedList tests passed.\n";
     return 0;
 }
\ No newline at end of file
@@ -2,6 +2,12 @@
 #include <cassert>
 #include <iostream>
 #include <numeric>
+#include <memory>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <cstring>
+#include <stdexcept>
 
 struct Counter {
     static int constructions;
@@ -20,6 +26,30 @@ struct Counter {
     int Counter::copies = 0;
     int Counter::moves = 0;
 
+// owns heap memory but never points into itself, so it opts into memcpy relocation
+struct Owned {
+    std::unique_ptr<int> p;
+    Owned(int v = 0) : p(new int(v)) {}
+};
+template <> struct is_trivially_relocatable<Owned> : std::true_type {};
+
+// copy-only (so moves copy too) and made to throw after copies_left copies
+struct Fragile {
+    static int copies_left;
+    static int live;
+    std::string text;
+    Fragile(int v) : text(40, static_cast<char>('a' + v)) {++live;}
+    Fragile(const Fragile& o) : text(o.text) {tick(); ++live;}
+    Fragile& operator=(const Fragile& o) {tick(); text = o.text; return *this;}
+    ~Fragile() {--live;}
+    static void tick() {
+        if (copies_left == 0) throw std::runtime_error("copy failed");
+        if (copies_left > 0) --copies_left;
+    }
+};
+int Fragile::copies_left = -1;
+int Fragile::live = 0;
+
 int main() {
     DynamicArray<int> a;
     a.push_back(10);
@@ -199,6 +229,183 @@ int main() {
         assert(a[a.size()-1] == 4);
     }
 
+    //insert and erase with a throwing copy: every slot stays a live element
+    {
+        {
+            DynamicArray<Fragile> arr;
+            arr.reserve(16);
+            for (int i = 0; i < 8; ++i) arr.push_back(Fragile(i));
+
+            Fragile::copies_left = 3;       // end slot, two shifts, then throw
+            bool threw = false;
+            try { arr.insert(0, Fragile(20)); } catch (const std::runtime_error&) { threw = true; }
+            Fragile::copies_left = -1;
+            assert(threw && arr.size() == 9 && Fragile::live == 9);
+            for (const Fragile& f : arr) assert(f.text.size() == 40);
+
+            Fragile::copies_left = 2;
+            threw = false;
+            try { arr.erase(0); } catch (const std::runtime_error&) { threw = true; }
+            Fragile::copies_left = -1;
+            assert(threw && arr.size() == 9 && Fragile::live == 9);
+            for (const Fragile& f : arr) assert(f.text.size() == 40);
+
+            Fragile::copies_left = 1;
+            threw = false;
+            try { arr.erase(arr.begin() + 1, arr.begin() + 3); } catch (const std::runtime_error&) { threw = true; }
+            Fragile::copies_left = -1;
+            assert(threw && arr.size() == 9 && Fragile::live == 9);
+
+            // and without a failure the order comes out right
+            DynamicArray<Fragile> b;
+            b.reserve(8);
+            for (int i = 0; i < 4; ++i) b.push_back(Fragile(i));
+            b.insert(1, Fragile(9));
+            b.erase(3);
+            assert(b.size() == 4 && b[0].text[0] == 'a' && b[1].text[0] == 'j' && b[2].text[0] == 'b' && b[3].text[0] == 'd');
+            assert(b.erase_if([](const Fragile& f){ return f.text[0] == 'j'; }) == 1);
+            assert(b.size() == 3 && b[1].text[0] == 'b');
+
+            // range insert with room to spare: a failed copy leaves b untouched
+            Fragile more[] = {Fragile(5), Fragile(6), Fragile(7)};
+            Fragile::copies_left = 4;
+            threw = false;
+            try { b.insert(1, more, more + 3); } catch (const std::runtime_error&) { threw = true; }
+            Fragile::copies_left = -1;
+            assert(threw && b.size() == 3 && b[0].text[0] == 'a' && b[1].text[0] == 'b' && b[2].text[0] == 'd');
+            b.insert(1, more, more + 3);
+            assert(b.size() == 6 && b[1].text[0] == 'f' && b[3].text[0] == 'h' && b[4].text[0] == 'b');
+        }
+        assert(Fragile::live == 0);
+
+        // the inserted value may be one of the elements, also when it grows
+        DynamicArray<std::string> s;
+        for (int i = 0; i < 4; ++i) s.push_back(std::string(40, static_cast<char>('a' + i)));
+        s.insert(0, s[1]);
+        s.insert(2, s[4]);
+        assert(s.size() == 6 && s[0][0] == 'b' && s[2][0] == 'd' && s[5][0] == 'd');
+    }
+
+    //relocation fast path: opted-in type survives grow, insert, erase and shrink
+    {
+        static_assert(is_trivially_relocatable_v<int>, "PODs relocate with memcpy");
+        static_assert(!is_trivially_relocatable_v<Counter>, "Counter takes the per-element path");
+        DynamicArray<Owned> arr;
+        for (int i = 0; i < 100; ++i) arr.emplace_back(i);      // several reallocations
+        arr.insert(0, Owned(-1));
+        arr.insert(50, Owned(-2));
+        assert(arr.size() == 102);
+        assert(*arr[0].p == -1 && *arr[1].p == 0 && *arr[50].p == -2 && *arr[51].p == 49);
+        arr.erase(50);
+        arr.erase(0);
+        for (int i = 0; i < 100; ++i) assert(*arr[i].p == i);
+        while (arr.size() > 3) arr.pop_back();                 // several shrinks
+        assert(*arr[0].p == 0 && *arr[2].p == 2);
+    }
+
+    //growth policies
+    {
+        static_assert(DefaultGrowthPolicy::grow(4) == 8, "doubling");
+        static_assert(CompactGrowthPolicy::grow(4) == 6 && CompactGrowthPolicy::grow(1) == 2, "1.5x, always grows");
+
+        DynamicArray<int, std::allocator<int>, CompactGrowthPolicy> c;
+        for (int i = 0; i < 10; ++i) c.push_back(i);
+        assert(c.capacity() == 13);                              // 1,2,3,4,6,9,13
+
+        // retain: drains keep the high-water capacity
+        DynamicArray<int, std::allocator<int>, RetainCapacityPolicy> r;
+        for (int i = 0; i < 100; ++i) r.push_back(i);
+        size_t cap = r.capacity();
+        for (int i = 0; i < 100; ++i) r.pop_back();
+        assert(r.empty() && r.capacity() == cap);
+        for (int i = 0; i < 50; ++i) r.push_back(i);
+        r.erase(0);
+        assert(r.capacity() == cap && r[0] == 1);
+
+        // explicit shrink_to_fit
+        r.shrink_to_fit();
+        assert(r.capacity() == r.size() && r.size() == 49);
+        for (int i = 0; i < 49; ++i) assert(r[i] == i + 1);
+        r.clear();
+        r.shrink_to_fit();
+        assert(r.capacity() == 0 && r.data() == nullptr);
+
+        // default policy: shrinks at quarter occupancy
+        DynamicArray<int> d;
+        for (int i = 0; i < 64; ++i) d.push_back(i);
+        for (int i = 0; i < 48; ++i) d.pop_back();
+        assert(d.capacity() == 32 && d.size() == 16);
+    }
+
+    //range insert/append/erase and erase_if
+    {
+        DynamicArray<int> a;
+        int src[] = {1, 2, 3};
+        a.append(src, src + 3);                    // [1,2,3] (grows from empty)
+        assert(a.size() == 3 && a[2] == 3);
+
+        int mid[] = {10, 11};
+        a.reserve(16);
+        a.insert(1, mid, mid + 2);                 // in place: [1,10,11,2,3]
+        assert(a.size() == 5 && a[0] == 1 && a[1] == 10 && a[2] == 11 && a[3] == 2 && a[4] == 3);
+
+        int many[20];
+        for (int i = 0; i < 20; ++i) many[i] = 100 + i;
+        a.insert(0, many, many + 20);              // grows: [100..119,1,10,11,2,3]
+        assert(a.size() == 25 && a[0] == 100 && a[19] == 119 && a[20] == 1 && a[24] == 3);
+
+        a.erase(a.begin() + 5, a.begin() + 20);    // [100..104,1,10,11,2,3]
+        assert(a.size() == 10 && a[4] == 104 && a[5] == 1 && a[9] == 3);
+        a.erase(a.begin(), a.begin());             // empty range is a no-op
+        assert(a.size() == 10);
+
+        size_t removed = a.erase_if([](int v){ return v >= 100; });
+        assert(removed == 5 && a.size() == 5);
+        assert(a[0] == 1 && a[1] == 10 && a[2] == 11 && a[3] == 2 && a[4] == 3);
+
+        // single-pass input iterators are staged first
+        std::istringstream in("7 8 9");
+        a.insert(2, std::istream_iterator<int>(in), std::istream_iterator<int>());
+        assert(a.size() == 8 && a[2] == 7 && a[3] == 8 && a[4] == 9 && a[5] == 11);
+
+        // non-trivial element type through both the grow and in-place paths
+        DynamicArray<std::string> s;
+        std::string words[] = {"alpha", "beta", "gamma", "delta"};
+        s.append(words, words + 4);
+        s.insert(1, words, words + 2);             // [alpha,alpha,beta,beta,gamma,delta]
+        assert(s.size() == 6 && s[1] == "alpha" && s[3] == "beta" && s[5] == "delta");
+        s.erase_if([](const std::string& w){ return w[0] == 'b'; });
+        assert(s.size() == 4 && s[2] == "gamma");
+        s.erase(s.begin(), s.begin() + 2);
+        assert(s.size() == 2 && s[0] == "gamma" && s[1] == "delta");
+    }
+
+    //spare capacity write API
+    {
+        DynamicArray<char> buf;
+        const char* text = "hello, spare capacity";
+        size_t len = std::strlen(text);
+        char* p = buf.spare_capacity(len);
+        assert(buf.spare_size() >= len && buf.size() == 0);
+        std::memcpy(p, text, len);
+        buf.commit_append(len);
+        assert(buf.size() == len && std::memcmp(buf.data(), text, len) == 0);
+
+        // a second chunk lands right after the first
+        p = buf.spare_capacity(3);
+        std::memcpy(p, "!!!", 3);
+        buf.commit_append(3);
+        assert(buf.size() == len + 3 && buf[len + 2] == '!' && buf[0] == 'h');
+
+        DynamicArray<int> ints;
+        ints.push_back(7);
+        ints.resize_for_overwrite(1000);
+        assert(ints.size() == 1000 && ints[0] == 7);
+        for (int i = 1; i < 1000; ++i) ints[i] = i;
+        ints.resize_for_overwrite(10);
+        assert(ints.size() == 10 && ints[9] == 9);
+    }
+
     //tests for clear
     {
         DynamicArray<int> arr;
@@ -0,0 +1,79 @@
+#include "../src/hazard_pointer.hpp"
+#include <cassert>
+#include <iostream>
+#include <atomic>
+#include <thread>
+
+struct Tracked {
+    static std::atomic<int> live;
+    int v;
+    explicit Tracked(int x) : v(x) { ++live; }
+    ~Tracked() { --live; }
+};
+std::atomic<int> Tracked::live{0};
+
+int main(){
+    // a guarded node survives collect(); it is freed once the guard lets go
+    {
+        std::atomic<Tracked*> shared{new Tracked(1)};
+        {
+            hazard::Guard g;
+            Tracked* p = g.protect(shared);
+            assert(p && p->v == 1);
+            shared.store(nullptr);
+            hazard::retire(p);
+            hazard::collect();
+            assert(Tracked::live == 1 && p->v == 1);   // still readable
+        }
+        hazard::collect();
+        assert(Tracked::live == 0);
+    }
+
+    // guards take distinct slots and give them back
+    {
+        std::atomic<Tracked*> a{new Tracked(1)}, b{new Tracked(2)};
+        for (int round = 0; round < 3; ++round) {
+            hazard::Guard g1, g2, g3, g4;              // all slots of this thread
+            assert(g1.protect(a)->v == 1 && g2.protect(b)->v == 2);
+        }
+        hazard::retire(a.load());
+        hazard::retire(b.load());
+        hazard::collect();
+        assert(Tracked::live == 0);
+    }
+
+    // another thread's hazard blocks reclamation; its exit releases the slot
+    {
+        std::atomic<Tracked*> shared{new Tracked(7)};
+        std::atomic<int> phase{0};
+        std::thread reader([&]{
+            hazard::Guard g;
+            Tracked* p = g.protect(shared);
+            phase = 1;
+            while (phase.load() != 2) std::this_thread::yield();
+            assert(p->v == 7);
+        });
+        while (phase.load() != 1) std::this_thread::yield();
+        Tracked* p = shared.exchange(nullptr);
+        hazard::retire(p);
+        hazard::collect();
+        assert(Tracked::live == 1);
+        phase = 2;
+        reader.join();
+        hazard::collect();
+        assert(Tracked::live == 0);
+    }
+
+    // nodes retired by exiting threads are adopted by later scans
+    {
+        std::thread t([]{
+            for (int i = 0; i < 10; ++i) hazard::retire(new Tracked(i));
+        });
+        t.join();
+        hazard::collect();
+        assert(Tracked::live == 0);
+    }
+
+    std::cout << "Hazard pointer tests passed.\n";
+    return 0;
+}
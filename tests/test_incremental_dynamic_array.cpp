@@ -0,0 +1,122 @@
+#include "../src/incremental_dynamic_array.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+struct Counter {
+    static int live;
+    int val;
+    Counter(int v = 0) : val(v) { ++live; }
+    Counter(const Counter& o) : val(o.val) { ++live; }
+    Counter(Counter&& o) noexcept : val(o.val) { ++live; o.val = -1; }
+    ~Counter() { --live; }
+};
+int Counter::live = 0;
+
+// copy-only and throws on demand, so migration takes the copying path
+struct Fragile {
+    static int copies_left;
+    int val;
+    Fragile(int v) : val(v) {}
+    Fragile(const Fragile& o) : val(o.val) {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+    }
+};
+int Fragile::copies_left = 1 << 30;
+
+int main(){
+    // growth leaves the old buffer in place and drains it a few elements per push
+    {
+        IncrementalDynamicArray<int, std::allocator<int>, DefaultGrowthPolicy, 2> a;
+        for (int i = 0; i < 64; ++i) a.push_back(i);
+        assert(a.capacity() == 64 && !a.is_migrating());
+        a.push_back(64);                                   // grows to 128, moves nothing
+        assert(a.capacity() == 128 && a.is_migrating() && a.migrated() == 0);
+        for (int i = 0; i <= 64; ++i) assert(a[i] == i);
+        a.push_back(65);
+        assert(a.migrated() == 2);
+        for (int i = 66; i < 96; ++i) a.push_back(i);
+        assert(a.is_migrating() && a.migrated() == 62);
+        a.push_back(96);                                   // 32 pushes x 2 moves = 64
+        assert(!a.is_migrating());
+        for (int i = 0; i < 97; ++i) assert(a[i] == i);
+    }
+
+    // random pushes/pops/reads against DynamicArray, element lifetimes balance
+    {
+        std::mt19937 rng(3);
+        {
+            IncrementalDynamicArray<Counter> a;
+            DynamicArray<int> ref;
+            for (int step = 0; step < 200000; ++step) {
+                unsigned op = rng() % 10;
+                if (op < 6 || ref.empty()) {
+                    int v = static_cast<int>(rng());
+                    a.emplace_back(v);
+                    ref.push_back(v);
+                } else if (op < 8) {
+                    a.pop_back();
+                    ref.pop_back();
+                } else {
+                    std::size_t i = rng() % ref.size();
+                    assert(a[i].val == ref[i]);
+                }
+                assert(a.size() == ref.size());
+            }
+            for (std::size_t i = 0; i < ref.size(); ++i) assert(a[i].val == ref[i]);
+            assert(Counter::live == static_cast<int>(a.size()));
+            a.finish_migration();
+            assert(!a.is_migrating());
+        }
+        assert(Counter::live == 0);
+    }
+
+    // pushing an element of the array itself while it migrates
+    {
+        IncrementalDynamicArray<std::string> a;
+        for (int i = 0; i < 17; ++i) a.push_back(std::to_string(i) + " padding past SSO");
+        assert(a.is_migrating());
+        a.push_back(a[1]);
+        a.push_back(std::string(a[2]));
+        assert(a[17] == "1 padding past SSO" && a[18] == "2 padding past SSO");
+
+        // a growing push that first finishes the previous migration
+        IncrementalDynamicArray<std::string> g;
+        g.push_back(std::string(40, 'x'));
+        g.push_back(g[0]);                            // grows, g[0] left behind
+        g.push_back(g[0]);                            // grows again mid-migration
+        assert(g.size() == 3 && g[1] == g[0] && g[2] == g[0]);
+
+        IncrementalDynamicArray<std::string> b(a);
+        assert(b.size() == 19 && !b.is_migrating() && b[5] == a[5]);
+        IncrementalDynamicArray<std::string> c(std::move(a));
+        assert(a.empty() && c.size() == 19 && c[18] == b[18]);
+        a = c;
+        assert(a.size() == 19 && a[0] == c[0]);
+        c.clear();
+        assert(c.empty() && !c.is_migrating());
+        c.reserve(100);
+        assert(c.capacity() == 100);
+    }
+
+    // a throwing migration step leaves push_back without effect
+    {
+        IncrementalDynamicArray<Fragile> a;
+        for (int i = 0; i < 9; ++i) a.push_back(Fragile(i));     // migration running
+        assert(a.is_migrating());
+        Fragile::copies_left = 1;                                // the new element, then fail
+        bool caught = false;
+        try { a.push_back(Fragile(9)); } catch (const std::runtime_error&) { caught = true; }
+        assert(caught && a.size() == 9);
+        Fragile::copies_left = 1 << 30;
+        for (int i = 0; i < 9; ++i) assert(a[i].val == i);
+        a.push_back(Fragile(9));
+        assert(a.size() == 10 && a[9].val == 9);
+    }
+
+    std::cout << "IncrementalDynamicArray tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "../src/intrusive_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <string>
+
+struct Idle;
+struct Timers;
+
+// on two doubly linked lists through tagged base hooks, one through a member
+// hook, and on a singly linked list through a base hook
+struct Conn : IntrusiveListHook<Idle>, IntrusiveListHook<Timers>, IntrusiveSListHook<> {
+    int id;
+    std::string name;
+    IntrusiveListHook<> owner_hook;
+    explicit Conn(int i = 0) : id(i), name("conn " + std::to_string(i)) {}
+};
+
+using IdleList  = IntrusiveList<Conn, IntrusiveBaseHook<IntrusiveListHook<Idle>>>;
+using TimerList = IntrusiveList<Conn, IntrusiveBaseHook<IntrusiveListHook<Timers>>>;
+using OwnerList = IntrusiveList<Conn, IntrusiveMemberHook<Conn, IntrusiveListHook<>, &Conn::owner_hook>>;
+using FreeList  = IntrusiveSList<Conn>;
+
+struct Plain : IntrusiveListHook<> { int v; explicit Plain(int x) : v(x) {} };
+
+template <typename List>
+bool ids_are(const List& l, std::initializer_list<int> ids) {
+    auto it = l.begin();
+    for (int id : ids) {
+        if (it == l.end() || it->id != id) return false;
+        ++it;
+    }
+    return it == l.end();
+}
+
+int main(){
+    // basic doubly linked operations, default base hook
+    {
+        Plain a(1), b(2), c(3);
+        IntrusiveList<Plain> l;
+        assert(l.empty() && l.begin() == l.end());
+        l.push_back(b);
+        l.push_front(a);
+        l.push_back(c);
+        assert(l.size() == 3 && l.front().v == 1 && l.back().v == 3);
+        assert(&l.front() == &a);                              // the object itself, no copy
+        int x = 3;
+        for (auto it = l.end(); it != l.begin();) assert((--it)->v == x--);
+        l.erase(b);
+        assert(!b.is_linked() && l.size() == 2);
+        l.insert(l.iterator_to(c), b);
+        assert(b.is_linked() && l.size() == 3);
+        l.pop_front();
+        l.pop_back();
+        assert(l.size() == 1 && &l.front() == &b && !a.is_linked() && !c.is_linked());
+        IntrusiveList<Plain> m(std::move(l));
+        assert(l.empty() && m.size() == 1);
+        m.push_back(a);
+        l = std::move(m);
+        assert(l.size() == 2 && &l.back() == &a);
+        l.push_front(c);
+        for (auto it = l.begin(); it != l.end();) it = l.erase(it);
+        assert(l.empty() && !a.is_linked() && !b.is_linked() && !c.is_linked());
+    }
+
+    // one object on several lists at once, O(1) unlink from any of them
+    {
+        DynamicArray<Conn> conns;
+        conns.reserve(10);
+        for (int i = 0; i < 10; ++i) conns.emplace_back(i);
+        IdleList idle;
+        TimerList timers;
+        OwnerList owned;
+        for (Conn& c : conns) {
+            idle.push_back(c);
+            if (c.id % 2 == 0) timers.push_front(c);
+            if (c.id < 3) owned.push_back(c);
+        }
+        assert(idle.size() == 10 && timers.size() == 5 && owned.size() == 3);
+        assert(ids_are(timers, {8, 6, 4, 2, 0}) && ids_are(owned, {0, 1, 2}));
+        assert(owned.front().name == "conn 0");               // member hook maps back to the object
+
+        idle.erase(conns[4]);
+        timers.erase(conns[4]);
+        owned.erase(conns[1]);
+        assert(ids_are(timers, {8, 6, 2, 0}) && ids_are(owned, {0, 2}));
+        assert(idle.size() == 9);
+        assert(static_cast<IntrusiveListHook<Timers>&>(conns[2]).is_linked());
+        assert(!conns[1].owner_hook.is_linked());
+
+        Conn copy(conns[0]);                                  // copies carry no links
+        assert(!copy.owner_hook.is_linked() && !static_cast<IntrusiveListHook<Idle>&>(copy).is_linked());
+
+        idle.clear();
+        timers.clear();
+        owned.clear();
+        assert(!conns[0].owner_hook.is_linked());
+    }
+
+    // singly linked list
+    {
+        Conn a(1), b(2), c(3), d(4);
+        FreeList f;
+        f.push_back(b);
+        f.push_front(a);
+        f.push_back(c);
+        assert(ids_are(f, {1, 2, 3}) && f.back().id == 3);
+        f.insert_after(f.begin(), d);
+        assert(ids_are(f, {1, 4, 2, 3}));
+        f.erase(c);                                           // the last one: back moves
+        assert(f.back().id == 2 && f.size() == 3);
+        f.push_back(c);
+        assert(f.back().id == 3);
+        f.pop_front();
+        auto it = f.erase_after(f.begin());                   // removes b
+        assert(it->id == 3 && ids_are(f, {4, 3}));
+        FreeList g(std::move(f));
+        g.push_back(a);
+        assert(f.empty() && ids_are(g, {4, 3, 1}) && g.back().id == 1);
+        g.clear();
+        assert(!static_cast<IntrusiveSListHook<>&>(a).is_linked());
+        assert(!static_cast<IntrusiveSListHook<>&>(d).is_linked());
+    }
+
+    // random churn against a reference of which ids are linked
+    {
+        std::mt19937 rng(4);
+        DynamicArray<Conn> conns;
+        conns.reserve(1000);
+        for (int i = 0; i < 1000; ++i) conns.emplace_back(i);
+        OwnerList l;
+        std::size_t linked = 0;
+        for (int step = 0; step < 100000; ++step) {
+            Conn& c = conns[rng() % 1000];
+            if (c.owner_hook.is_linked()) { l.erase(c); --linked; }
+            else if (rng() % 2) { l.push_back(c); ++linked; }
+            else { l.push_front(c); ++linked; }
+            assert(l.size() == linked);
+        }
+        std::size_t n = 0;
+        for (Conn& c : l) { assert(c.owner_hook.is_linked()); ++n; }
+        assert(n == linked);
+        l.clear();
+    }
+
+    std::cout << "IntrusiveList tests passed.\n";
+    return 0;
+}
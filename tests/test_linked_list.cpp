@@ -1,6 +1,10 @@
 #include "../src/linked_list.hpp"
+#include "../src/allocators.hpp"
 #include <cassert>
 #include <iostream>
+#include <random>
+#include <vector>
+#include <algorithm>
 
 struct Counter {
     static int constructions;
@@ -245,6 +249,246 @@ int main(){
     }
 }
 
+// pooled nodes: a private pool per list, freed nodes are handed out again
+{
+    using PooledList = LinkedList<int, NodePoolAllocator<int>>;
+    PooledList L;
+    for (int i = 0; i < 1000; i++) L.push_back(i);
+    PoolResource* pool = L.get_allocator().resource();
+    assert(pool->block_size() == sizeof(PooledList::Node));
+    const PooledList::Node* first = L.head();
+    L.pop_front();
+    L.push_front(-1);
+    assert(L.head() == first && L.size() == 1000);   // same block back
+    L.insert_at(500, 7);
+    L.pop_back();
+
+    PooledList copy(L);                               // copies share the pool
+    assert(copy.get_allocator() == L.get_allocator());
+    assert(copy.size() == 1000 && copy.head()->data == -1);
+
+    PooledList other;
+    assert(other.get_allocator() != L.get_allocator());
+    other.push_back(1);
+    other = L;                                        // keeps its own pool
+    assert(other.get_allocator() != L.get_allocator() && other.size() == 1000);
+    other = std::move(copy);                          // takes copy's nodes and pool
+    assert(other.get_allocator() == L.get_allocator() && copy.empty());
+    copy.push_back(5);                                // moved-from list still works
+    assert(copy.head()->data == 5);
+}
+
+// several lists drawing from one shared pool
+{
+    NodePoolAllocator<Counter> shared(16);
+    int live = Counter::constructions - Counter::destructions;
+    {
+        LinkedList<Counter, NodePoolAllocator<Counter>> a(shared), b(shared);
+        for (int i = 0; i < 100; i++) { a.push_back(Counter(i)); b.push_front(Counter(i)); }
+        while (!a.empty()) a.pop_front();
+        for (int i = 0; i < 100; i++) b.push_back(Counter(i));
+        assert(b.size() == 200 && a.get_allocator() == b.get_allocator());
+    }
+    assert(Counter::constructions - Counter::destructions == live);
+}
+
+// a plain PoolResource sized on first use
+{
+    PoolResource pool(0, 8);
+    LinkedList<int, PoolAllocator<int>> L{PoolAllocator<int>(pool)};
+    for (int i = 0; i < 20; i++) L.push_back(i);
+    assert(pool.block_size() == sizeof(LinkedList<int>::Node));
+    int x = 0;
+    for (int v : L) assert(v == x++);
+}
+
+// sort relinks nodes: stable, element addresses unchanged, tail kept
+{
+    std::mt19937 rng(9);
+    for (int n : {0, 1, 2, 3, 17, 1000, 4097}) {
+        LinkedList<std::pair<int, int>> L;
+        std::vector<std::pair<int, int>> ref;
+        for (int i = 0; i < n; i++) {
+            std::pair<int, int> p(static_cast<int>(rng() % 50), i);
+            L.push_back(p);
+            ref.push_back(p);
+        }
+        std::vector<const std::pair<int, int>*> addr;
+        for (auto& p : L) addr.push_back(&p);
+        auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+        L.sort(by_key);
+        std::stable_sort(ref.begin(), ref.end(), by_key);
+        assert(L.size() == static_cast<std::size_t>(n));
+        std::size_t i = 0;
+        for (auto& p : L) {
+            assert(p == ref[i++]);
+            assert(addr[p.second] == &p);
+        }
+        if (n) assert(L.tail()->data == ref.back() && L.tail()->next == nullptr);
+    }
+    LinkedList<int> D;
+    for (int i = 0; i < 10; i++) D.push_back(i);
+    D.sort(std::greater<>());
+    assert(D.head()->data == 9 && D.tail()->data == 0);
+}
+
+// merge and splice take over the other list's nodes
+{
+    LinkedList<int> a, b;
+    for (int i : {1, 3, 5, 7}) a.push_back(i);
+    for (int i : {2, 3, 8, 9}) b.push_back(i);
+    const int* eight = &b.head()->next->next->data;
+    a.merge(b);
+    assert(a.size() == 8 && b.empty() && b.head() == nullptr && b.tail() == nullptr);
+    int expect[] = {1, 2, 3, 3, 5, 7, 8, 9};
+    int k = 0;
+    for (int v : a) assert(v == expect[k++]);
+    assert(a.tail()->data == 9 && &a.head()->next->next->next->next->next->next->data == eight);
+    b.merge(a);                                        // into an empty list
+    assert(b.size() == 8 && a.empty() && b.tail()->data == 9);
+    a.push_back(100);
+    b.merge(a);
+    assert(b.tail()->data == 100);
+
+    LinkedList<int> c, d;
+    for (int i = 0; i < 3; i++) c.push_back(i);       // 0 1 2
+    for (int i = 10; i < 12; i++) d.push_back(i);     // 10 11
+    c.splice(1, d);                                   // 0 10 11 1 2
+    assert(d.empty() && c.size() == 5);
+    int e1[] = {0, 10, 11, 1, 2};
+    k = 0;
+    for (int v : c) assert(v == e1[k++]);
+    LinkedList<int> f;
+    f.push_back(-1);
+    c.splice(0, f);
+    f.push_back(99);
+    c.splice(c.size(), f);
+    assert(c.head()->data == -1 && c.tail()->data == 99 && c.size() == 7);
+    LinkedList<int> g;
+    g.splice(0, std::move(c));
+    assert(g.size() == 7 && g.tail()->data == 99);
+    g.push_back(5);
+    assert(g.tail()->data == 5);
+}
+
+// reverse, remove_if, unique
+{
+    LinkedList<int> L;
+    L.reverse();
+    for (int i = 0; i < 10; i++) L.push_back(i);
+    L.reverse();
+    int x = 9;
+    for (int v : L) assert(v == x--);
+    assert(L.tail()->data == 0);
+    L.push_back(-1);                                  // tail still valid after reverse
+
+    assert(L.remove_if([](int v) { return v % 2 != 0; }) == 6);   // odd values and -1
+    assert(L.size() == 5 && L.head()->data == 8 && L.tail()->data == 0);
+    assert(L.remove_if([](int v) { return v == 0; }) == 1);
+    assert(L.tail()->data == 2);
+    L.push_back(7);
+    assert(L.tail()->data == 7);
+    assert(L.remove_if([](int) { return true; }) == 5 && L.empty() && L.tail() == nullptr);
+
+    for (int v : {1, 1, 2, 2, 2, 3, 1, 1}) L.push_back(v);
+    assert(L.unique() == 4);
+    int e[] = {1, 2, 3, 1};
+    int k = 0;
+    for (int v : L) assert(v == e[k++]);
+    assert(L.tail()->data == 1 && L.size() == 4);
+    assert(L.unique([](int a, int b) { return a + 1 == b; }) == 1);   // drops the 2 after 1
+    assert(L.size() == 3);
+}
+
+// a predicate that throws part way leaves size() and tail() right
+{
+    LinkedList<int> L;
+    for (int i = 0; i < 6; i++) L.push_back(i);
+    bool threw = false;
+    try {
+        L.remove_if([](int v) { if (v == 4) throw 4; return v % 2 != 0; });
+    } catch (int) { threw = true; }
+    assert(threw && L.size() == 4 && L.tail()->data == 5);           // [0,2,4,5]
+    L.remove_if([](int v) { return v == 5; });
+    assert(L.size() == 3 && L.tail()->data == 4);
+
+    L.push_back(4);
+    L.push_back(4);
+    L.push_back(9);                                                   // [0,2,4,4,4,9]
+    threw = false;
+    try {
+        L.unique([](int a, int b) { if (b == 9) throw 9; return a == b; });
+    } catch (int) { threw = true; }
+    assert(threw && L.size() == 4 && L.tail()->data == 9);           // [0,2,4,9]
+    L.pop_back();
+    assert(L.size() == 3 && L.tail()->data == 4);
+    std::size_t n = 0;
+    for (int v : L) { (void)v; ++n; }
+    assert(n == 3);
+}
+
+// a comparator that throws part way through sort or merge loses no node
+{
+    auto count = [](const LinkedList<int>& l) {
+        std::size_t n = 0;
+        const LinkedList<int>::Node* last = nullptr;
+        for (const auto* p = l.head(); p; p = p->next) { last = p; ++n; }
+        assert(last == l.tail());
+        return n;
+    };
+    for (int limit : {0, 3, 12, 18}) {
+        LinkedList<int> L;
+        for (int i = 0; i < 10; i++) L.push_back((i * 7) % 10);
+        int calls = 0;
+        bool threw = false;
+        try {
+            L.sort([&](int a, int b) { if (calls++ == limit) throw limit; return a < b; });
+        } catch (int) { threw = true; }
+        assert(threw && L.size() == 10 && count(L) == 10);
+        int sum = 0;
+        for (int v : L) sum += v;
+        assert(sum == 45);
+        L.sort();
+        int x = 0;
+        for (int v : L) assert(v == x++);
+    }
+    for (int limit : {1, 2, 5}) {           // call 0 picks the merged tail
+        LinkedList<int> a, b;
+        for (int i = 0; i < 6; i++) { a.push_back(2 * i); b.push_back(2 * i + 1); }
+        int calls = 0;
+        bool threw = false;
+        try {
+            a.merge(b, [&](int x, int y) { if (calls++ == limit) throw limit; return x < y; });
+        } catch (int) { threw = true; }
+        assert(threw && a.size() == 12 && count(a) == 12);
+        assert(b.empty() && b.head() == nullptr && b.tail() == nullptr);
+        a.sort();
+        int x = 0;
+        for (int v : a) assert(v == x++);
+    }
+}
+
+// relinking works across lists sharing a pool
+{
+    NodePoolAllocator<Counter> shared;
+    int live = Counter::constructions - Counter::destructions;
+    {
+        LinkedList<Counter, NodePoolAllocator<Counter>> a(shared), b(shared);
+        for (int i = 0; i < 100; i++) a.push_back(Counter(100 - i));
+        for (int i = 0; i < 50; i++) b.push_back(Counter(i * 2));
+        int copies = Counter::copies;
+        a.sort([](const Counter& l, const Counter& r) { return l.val < r.val; });
+        b.merge(a, [](const Counter& l, const Counter& r) { return l.val < r.val; });
+        b.remove_if([](const Counter& c) { return c.val > 50; });
+        b.unique([](const Counter& l, const Counter& r) { return l.val == r.val; });
+        assert(Counter::copies == copies);
+        int prev = -1;
+        for (const Counter& c : b) { assert(c.val > prev); prev = c.val; }
+        assert(b.size() == 51);
+    }
+    assert(Counter::constructions - Counter::destructions == live);
+}
+
 std::cout << "LinkedList tests passed.\n";
 
 }
\ No newline at end of file
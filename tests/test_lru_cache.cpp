@@ -0,0 +1,85 @@
+#include "../src/lru_cache.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(){
+    // count capacity: the least recently used entry is evicted
+    {
+        LRUCache<int, std::string> c(3);
+        assert(c.empty() && c.capacity() == 3);
+        assert(c.put(1, "one") && c.put(2, "two") && c.put(3, "three"));
+        assert(c.size() == 3 && c.weight() == 3);
+        assert(*c.get(1) == "one");                     // order now 1 3 2
+        assert(c.put(4, "four"));                       // evicts 2
+        assert(!c.contains(2) && c.get(2) == nullptr);
+        assert(c.contains(1) && c.contains(3) && c.contains(4));
+        assert(c.hits() == 1 && c.misses() == 1 && c.evictions() == 1);
+        assert(*c.peek(3) == "three");                  // peek does not refresh 3
+        assert(c.put(5, "five"));                       // evicts 3
+        assert(!c.contains(3) && c.hits() == 1 && c.misses() == 1);
+        c.reset_stats();
+        assert(c.hits() == 0 && c.misses() == 0 && c.evictions() == 0);
+    }
+
+    // replacing refreshes the entry; erase and clear do not count as evictions
+    {
+        LRUCache<std::string, int> c(2);
+        std::vector<std::string> evicted;
+        c.set_eviction_callback([&](const std::string& k, int& v){
+            evicted.push_back(k + "=" + std::to_string(v));
+        });
+        c.put("a", 1);
+        c.put("b", 2);
+        c.put("a", 10);                                 // a is now most recent
+        assert(c.size() == 2 && *c.peek("a") == 10);
+        c.put("c", 3);
+        assert(evicted.size() == 1 && evicted[0] == "b=2");
+        assert(c.erase("a") && !c.erase("a"));
+        assert(c.size() == 1 && evicted.size() == 1);
+        c.clear();
+        assert(c.empty() && c.weight() == 0 && evicted.size() == 1);
+        c.put("d", 4);
+        c.put("e", 5);
+        c.set_capacity(1);
+        assert(c.size() == 1 && c.contains("e") && evicted.back() == "d=4");
+    }
+
+    // weight capacity: entries are weighed by string length
+    {
+        LRUCache<int, std::string> c(10, [](const int&, const std::string& s){ return s.size(); });
+        std::vector<int> evicted;
+        c.set_eviction_callback([&](const int& k, std::string&){ evicted.push_back(k); });
+        c.put(1, "aaaa");
+        c.put(2, "bbbb");
+        assert(c.weight() == 8 && evicted.empty());
+        c.put(3, "cccccc");                             // 14 > 10: evicts 1
+        assert(c.weight() == 10 && evicted == std::vector<int>{1});
+        c.put(2, "b");                                  // shrinks in place
+        assert(c.weight() == 7 && c.size() == 2);
+        c.put(4, "ddddddd");                            // evicts 3, keeps 2
+        assert(c.weight() == 8 && evicted == (std::vector<int>{1, 3}));
+        assert(!c.put(5, "far more than ten"));         // too heavy: not stored
+        assert(!c.contains(5) && c.weight() == 8);
+        assert(!c.put(2, "also far too heavy"));        // drops the old value
+        assert(!c.contains(2) && c.weight() == 7 && c.size() == 1);
+        assert(c.evictions() == 2);
+    }
+
+    // heavy churn through the pools stays consistent
+    {
+        LRUCache<int, int> c(100);
+        for(int i = 0; i < 10000; ++i){
+            int k = (i * 7919) % 300;
+            if(int* v = c.get(k)) assert(*v == k);
+            else c.put(k, k);
+            assert(c.size() <= 100);
+        }
+        assert(c.hits() + c.misses() == 10000);
+        assert(c.evictions() == c.misses() - c.size());
+    }
+
+    std::cout << "LRUCache tests passed.\n";
+    return 0;
+}
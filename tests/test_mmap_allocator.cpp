@@ -0,0 +1,45 @@
+#include "../src/mmap_allocator.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+
+int main(){
+    // a tiny threshold so the test crosses malloc -> mmap -> mremap -> malloc
+    using Small = LargeBufferAllocator<long, 4096>;
+    static_assert(relocation::allocator_can_reallocate<Small, long>::value, "reallocate is detected");
+    static_assert(!relocation::allocator_can_reallocate<std::allocator<long>, long>::value, "std::allocator has none");
+
+    {
+        DynamicArray<long, Small> a;
+        for (long i = 0; i < 100000; ++i) a.push_back(i * 3);   // ~800 KB: many mremap growths
+        for (long i = 0; i < 100000; ++i) assert(a[i] == i * 3);
+
+        a.insert(0, -1);
+        a.erase(a.begin() + 1, a.begin() + 50001);
+        assert(a.size() == 50001 && a[0] == -1 && a[1] == 150000);
+
+        while (a.size() > 10) a.pop_back();                     // shrinks back below the threshold
+        assert(a.capacity() * sizeof(long) < 4096);
+        for (long i = 1; i < 10; ++i) assert(a[i] == (49999 + i) * 3);
+
+        DynamicArray<long, Small> b(a);                           // copies through allocate()
+        assert(b.size() == 10 && b[9] == a[9]);
+        a.shrink_to_fit();
+        assert(a.capacity() == 10);
+    }
+
+    // huge-page mode and a non-trivially relocatable type (regular path)
+    {
+        DynamicArray<int, LargeBufferAllocator<int, 1 << 16, true>> h;
+        for (int i = 0; i < 200000; ++i) h.push_back(i);
+        assert(h[199999] == 199999);
+
+        DynamicArray<std::string, LargeBufferAllocator<std::string, 4096>> s;
+        for (int i = 0; i < 1000; ++i) s.push_back(std::to_string(i));
+        assert(s[999] == "999");
+    }
+
+    std::cout << "LargeBufferAllocator tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "../src/parallel.hpp"
+#include <cassert>
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+int main(){
+    // every task index runs exactly once, also with more tasks than threads
+    {
+        ThreadPool pool(4);
+        assert(pool.size() == 4);
+        DynamicArray<int> hits(1000, 0);
+        for (int round = 0; round < 20; ++round) {
+            pool.run(hits.size(), [&](std::size_t i){ ++hits[i]; });
+        }
+        for (std::size_t i = 0; i < hits.size(); ++i) assert(hits[i] == 20);
+    }
+
+    // exceptions reach the caller and the pool stays usable
+    {
+        ThreadPool pool(3);
+        bool caught = false;
+        try {
+            pool.run(100, [](std::size_t i){ if (i == 42) throw std::runtime_error("task 42"); });
+        } catch (const std::runtime_error&) { caught = true; }
+        assert(caught);
+        std::atomic<int> count{0};
+        pool.run(10, [&](std::size_t){ ++count; });
+        assert(count == 10);
+    }
+
+    // chunk boundaries cover the range and sit on cache lines
+    {
+        alignas(64) static std::int32_t buf[1000];
+        const std::int32_t* base = buf + 3;                  // misaligned start
+        std::size_t n = 997, chunks = 7;
+        std::size_t prev = 0;
+        for (std::size_t c = 1; c < chunks; ++c) {
+            std::size_t b = parallel::detail::chunk_begin(base, n, chunks, c);
+            assert(b >= prev && b <= n);
+            assert(reinterpret_cast<std::uintptr_t>(base + b) % 64 == 0);
+            prev = b;
+        }
+        assert(parallel::detail::chunk_begin(base, n, chunks, chunks) == n);
+    }
+
+    // fill / for_each / transform / reduce against the sequential result
+    {
+        ThreadPool pool(4);
+        const std::size_t N = 100003;
+        DynamicArray<long> a(N);
+        parallel::fill(pool, a, 2L);
+        for (std::size_t i = 0; i < N; ++i) assert(a[i] == 2);
+
+        parallel::for_each(pool, a, [](long& v){ v *= 3; });
+        for (std::size_t i = 0; i < N; ++i) assert(a[i] == 6);
+
+        for (std::size_t i = 0; i < N; ++i) a[i] = static_cast<long>(i);
+        DynamicArray<double> half(N);
+        parallel::transform(pool, a, half, [](long v){ return v / 2.0; });
+        for (std::size_t i = 0; i < N; ++i) assert(half[i] == i / 2.0);
+
+        long sum = parallel::reduce(pool, a, 0L, [](long x, long y){ return x + y; });
+        assert(sum == static_cast<long>(N * (N - 1) / 2));
+
+        long mx = parallel::reduce(pool, a.begin(), a.begin() + 10, 0L, [](long x, long y){ return x > y ? x : y; });
+        assert(mx == 9);
+
+        // ranges shorter than the pool
+        DynamicArray<int> tiny(2, 5);
+        assert(parallel::reduce(pool, tiny, 0, [](int x, int y){ return x + y; }) == 10);
+        DynamicArray<int> none;
+        assert(parallel::reduce(pool, none, 7, [](int x, int y){ return x + y; }) == 7);
+    }
+
+    std::cout << "Parallel tests passed.\n";
+    return 0;
+}
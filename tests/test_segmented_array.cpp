@@ -0,0 +1,87 @@
+#include "../src/segmented_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+int main(){
+    // default block size is about a page
+    static_assert(SegmentedArray<int>::block_size == 1024, "4096 / sizeof(int)");
+    static_assert(SegmentedArray<char[3000]>::block_size == 1, "at least one element per block");
+
+    // push_back, indexing across block boundaries, stable references
+    {
+        SegmentedArray<int, 8> a;
+        assert(a.empty() && a.capacity() == 0);
+        a.push_back(100);
+        int& first = a[0];
+        for (int i = 1; i < 1000; ++i) a.push_back(i);
+        assert(a.size() == 1000 && a.capacity() == 1000);
+        assert(&a[0] == &first && first == 100);
+        for (int i = 1; i < 1000; ++i) assert(a[i] == i);
+        assert(&a[7] == &a[0] + 7);                      // contiguous within a block
+        assert(a.front() == 100 && a.back() == 999);
+
+        a.pop_back();
+        a.pop_back();
+        assert(a.size() == 998 && a.back() == 997);
+        assert(a.capacity() == 1000);
+        a.shrink_to_fit();
+        assert(a.capacity() == 1000);                    // block 124 still holds elements
+        for (int i = 0; i < 6; ++i) a.pop_back();
+        a.shrink_to_fit();
+        assert(a.capacity() == 992 && a.size() == 992);
+    }
+
+    // iterators are random access and work with <algorithm>
+    {
+        SegmentedArray<int, 4> a;
+        for (int i = 0; i < 50; ++i) a.push_back(49 - i);
+        std::sort(a.begin(), a.end());
+        for (int i = 0; i < 50; ++i) assert(a[i] == i);
+        assert(std::accumulate(a.begin(), a.end(), 0) == 49 * 50 / 2);
+        assert(a.end() - a.begin() == 50);
+        auto it = std::lower_bound(a.begin(), a.end(), 17);
+        assert(*it == 17 && it - a.begin() == 17);
+        const SegmentedArray<int, 4>& c = a;
+        SegmentedArray<int, 4>::const_iterator ci = a.begin();
+        assert(ci == c.begin() && ci[10] == 10);
+    }
+
+    // for_each_block visits every element once, in order
+    {
+        SegmentedArray<int, 16> a;
+        for (int i = 0; i < 100; ++i) a.push_back(i);
+        int expect = 0;
+        std::size_t runs = 0;
+        a.for_each_block([&](int* p, std::size_t n){
+            ++runs;
+            for (std::size_t i = 0; i < n; ++i) assert(p[i] == expect++);
+        });
+        assert(expect == 100 && runs == 7);
+    }
+
+    // copy, move, assignment with non-trivial elements
+    {
+        SegmentedArray<std::string, 4> a;
+        for (int i = 0; i < 30; ++i) a.emplace_back(std::to_string(i) + " long enough to leave SSO behind");
+        SegmentedArray<std::string, 4> b(a);
+        assert(b.size() == 30 && b[29] == a[29] && &b[29] != &a[29]);
+        const std::string* p = &a[3];
+        SegmentedArray<std::string, 4> c(std::move(a));
+        assert(a.empty() && &c[3] == p);                 // move keeps addresses
+        b = c;
+        assert(b.size() == 30 && b[0] == c[0]);
+        c = std::move(b);
+        assert(c.size() == 30 && b.empty());
+        p = &c[3];
+        c.reserve(100);
+        assert(c.capacity() == 100 && &c[3] == p);       // reserve only adds blocks
+        c.clear();
+        assert(c.empty() && c.capacity() == 0);
+    }
+
+    std::cout << "SegmentedArray tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "../src/simd.hpp"
+#include <cassert>
+#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+// Every kernel on every supported ISA must agree with the scalar loop,
+// including tails shorter than a vector and unaligned starts.
+template <typename T>
+void check_against_scalar(const DynamicArray<T>& arr, T probe) {
+    for (std::size_t off = 0; off < 3 && off < arr.size(); ++off) {
+        const T* p = arr.data() + off;
+        for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(3), std::size_t(7),
+                              std::size_t(8), std::size_t(9), std::size_t(33), arr.size() - off}) {
+            if (n > arr.size() - off) continue;
+            assert(simd::find(p, n, probe) == simd::scalar::find(p, n, probe));
+            assert(simd::count(p, n, probe) == simd::scalar::count(p, n, probe));
+            if (n > 0) {
+                assert(simd::min(p, n) == simd::scalar::min(p, n));
+                assert(simd::max(p, n) == simd::scalar::max(p, n));
+            }
+            if constexpr (std::is_floating_point<T>::value) {
+                double expect = simd::scalar::sum(p, n);
+                assert(std::fabs(simd::sum(p, n) - expect) <= 1e-9 * (1.0 + std::fabs(expect)));
+            } else {
+                assert(simd::sum(p, n) == simd::scalar::sum(p, n));
+            }
+        }
+    }
+}
+
+int main(){
+    std::mt19937_64 rng(7);
+    DynamicArray<std::int32_t> ints;
+    DynamicArray<float> floats;
+    DynamicArray<std::uint64_t> u64s;
+    for (int i = 0; i < 1000; ++i) {
+        ints.push_back(static_cast<std::int32_t>(rng() % 200) - 100);
+        floats.push_back(static_cast<float>(static_cast<int>(rng() % 2000) - 1000) / 8.0f);
+        u64s.push_back(rng() % 64 == 0 ? ~std::uint64_t(0) - rng() % 3 : rng() % 100);
+    }
+
+    for (simd::Isa isa : {simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2}) {
+        simd::set_isa(isa);
+        assert(static_cast<int>(simd::active_isa()) <= static_cast<int>(isa));
+        check_against_scalar(ints, ints[500]);
+        check_against_scalar(ints, std::int32_t(12345));           // absent
+        check_against_scalar(floats, floats[777]);
+        check_against_scalar(floats, 0.3f);
+        check_against_scalar(u64s, u64s[999]);
+        check_against_scalar(u64s, ~std::uint64_t(0));             // min/max across the sign bit
+        // only the upper or lower 32 bits matching must not count as a match
+        check_against_scalar(u64s, std::uint64_t(5) << 32);
+    }
+    simd::set_isa(simd::Isa::avx2);
+
+    // DynamicArray entry points and value placement
+    {
+        DynamicArray<std::int32_t> a;
+        for (std::int32_t i = 0; i < 100; ++i) a.push_back(i);
+        assert(simd::find(a, 0) == 0);
+        assert(simd::find(a, 99) == 99);
+        assert(simd::find(a, 100) == a.size());
+        assert(simd::count(a, 42) == 1);
+        assert(simd::min(a) == 0 && simd::max(a) == 99);
+        assert(simd::sum(a) == 4950);
+    }
+
+    // int32 sums widen instead of overflowing
+    {
+        DynamicArray<std::int32_t> a(1000, 2000000000);
+        assert(simd::sum(a) == 2000000000LL * 1000);
+        DynamicArray<std::int32_t> b(1000, -2000000000);
+        assert(simd::sum(b) == -2000000000LL * 1000);
+    }
+
+    // uint64 min/max compare unsigned
+    {
+        DynamicArray<std::uint64_t> a(17, std::uint64_t(1) << 63);
+        a[9] = 1;
+        a[16] = ~std::uint64_t(0);
+        assert(simd::min(a) == 1);
+        assert(simd::max(a) == ~std::uint64_t(0));
+    }
+
+    // types without vector kernels use the scalar loops
+    {
+        DynamicArray<double> d;
+        for (int i = 0; i < 10; ++i) d.push_back(i * 0.5);
+        assert(simd::find(d, 2.0) == 4);
+        assert(simd::max(d) == 4.5);
+        DynamicArray<short> s(10, 3);
+        assert(simd::sum(s) == 30 && simd::count(s, short(3)) == 10);
+    }
+
+    std::cout << "SIMD tests passed.\n";
+    return 0;
+}
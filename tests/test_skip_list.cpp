@@ -0,0 +1,106 @@
+#include "../src/skip_list.hpp"
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(){
+    // set: ordered, unique, and searchable by bound
+    {
+        SkipListSet<int> s;
+        assert(s.empty() && s.begin() == s.end() && !s.contains(1));
+        for(int x : {5, 1, 9, 3, 7, 3, 5}) s.insert(x);
+        assert(s.size() == 5);
+        std::vector<int> in_order(s.begin(), s.end());
+        assert(in_order == (std::vector<int>{1, 3, 5, 7, 9}));
+        assert(!s.insert(7).second && s.insert(8).second);
+        assert(*s.lower_bound(4) == 5 && *s.lower_bound(5) == 5);
+        assert(*s.upper_bound(5) == 7 && s.upper_bound(9) == s.end());
+        assert(s.find(6) == s.end() && *s.find(8) == 8);
+        assert(s.erase(3) == 1 && s.erase(3) == 0 && !s.contains(3));
+        auto it = s.erase(s.find(7));
+        assert(*it == 8 && s.size() == 4);
+        std::vector<int> range;
+        for(auto i = s.lower_bound(2); i != s.upper_bound(8); ++i) range.push_back(*i);
+        assert(range == (std::vector<int>{5, 8}));
+        s.clear();
+        assert(s.empty() && s.begin() == s.end());
+        s.insert(1);
+        assert(s.size() == 1);
+    }
+
+    // map: values change in place; emplace drops a duplicate it built
+    {
+        SkipListMap<std::string, int> m;
+        assert(m.insert({"b", 2}).second);
+        assert(m.emplace("a", 1).second);
+        auto r = m.emplace("a", 100);
+        assert(!r.second && r.first -> second == 1);
+        m.find("b") -> second = 20;
+        assert(m.find("b") -> second == 20 && m.begin() -> first == "a");
+        const SkipListMap<std::string, int>& cm = m;
+        assert(cm.find("a") != cm.end() && cm.find("z") == cm.end());
+    }
+
+    // custom order
+    {
+        SkipListSet<int, std::greater<int>> s;
+        for(int i = 0; i < 10; ++i) s.insert(i);
+        assert(*s.begin() == 9 && *s.lower_bound(4) == 4 && *s.upper_bound(4) == 3);
+    }
+
+    // against std::map under random inserts and erases
+    {
+        SkipListMap<int, int> m;
+        std::map<int, int> ref;
+        std::mt19937 rng(11);
+        for(int i = 0; i < 20000; ++i){
+            int k = static_cast<int>(rng() % 2000);
+            if(rng() % 3){
+                assert(m.insert({k, i}).second == ref.insert({k, i}).second);
+            }
+            else{
+                assert(m.erase(k) == ref.erase(k));
+            }
+        }
+        assert(m.size() == ref.size());
+        auto it = m.begin();
+        for(const auto& p : ref){
+            assert(it -> first == p.first && it -> second == p.second);
+            ++it;
+        }
+        assert(it == m.end());
+        for(int k = -1; k <= 2000; k += 7){
+            auto lb = ref.lower_bound(k);
+            auto mlb = m.lower_bound(k);
+            assert(lb == ref.end() ? mlb == m.end() : mlb -> first == lb -> first);
+        }
+    }
+
+    // copies are deep and independent; moves leave an empty, usable list
+    {
+        SkipListMap<int, std::string> a;
+        for(int i = 0; i < 1000; ++i) a.emplace(i, std::string(30, char('a' + i % 26)));
+        SkipListMap<int, std::string> b(a);
+        assert(b.size() == 1000 && b.find(500) -> second == a.find(500) -> second);
+        for(int i = 0; i < 1000; i += 2) b.erase(i);
+        assert(a.size() == 1000 && b.size() == 500 && !b.contains(10) && b.contains(11));
+        SkipListMap<int, std::string> c(std::move(a));
+        assert(a.empty() && a.begin() == a.end() && c.size() == 1000);
+        a.emplace(1, "x");
+        assert(a.size() == 1 && a.find(1) -> second == "x");
+        a = c;
+        assert(a.size() == 1000 && c.size() == 1000);
+        c = std::move(b);
+        assert(c.size() == 500 && c.contains(999));
+        std::size_t n = 0;
+        for(auto i = c.begin(); i != c.end(); ++i) assert(i -> first % 2 == 1 && ++n);
+        assert(n == 500);
+    }
+
+    std::cout << "SkipList tests passed.\n";
+    return 0;
+}
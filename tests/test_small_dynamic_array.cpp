@@ -0,0 +1,182 @@
+#include "../src/small_dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+struct Counter {
+    static int constructions;
+    static int destructions;
+    int val;
+    Counter(int v = 0) : val(v) {++constructions;}
+    Counter(const Counter& o): val(o.val) {++constructions;}
+    Counter(Counter&& o) noexcept : val(o.val) {++constructions; o.val = -1;}
+    ~Counter() {++destructions;}
+};
+
+int Counter::constructions = 0;
+int Counter::destructions = 0;
+
+// throws on the copy that matches `trigger`
+struct Thrower {
+    static int trigger;
+    int val;
+    Thrower(int v = 0) : val(v) {}
+    Thrower(const Thrower& o) : val(o.val) { if (val == trigger) throw 1; }
+    Thrower& operator=(const Thrower&) = default;
+};
+int Thrower::trigger = -1;
+
+// memcpy-relocatable by opt-in, yet its copy constructor can throw
+struct Relocatable {
+    static int copies_left;
+    int val;
+    Relocatable(int v) : val(v) {}
+    Relocatable(const Relocatable& o) : val(o.val) { if (copies_left-- == 0) throw 1; }
+    Relocatable& operator=(const Relocatable&) = default;
+};
+int Relocatable::copies_left = 1 << 30;
+template <> struct is_trivially_relocatable<Relocatable> : std::true_type {};
+
+int main(){
+    // stays inline up to N
+    {
+        SmallDynamicArray<int, 4> a;
+        assert(a.empty() && a.is_inline() && a.capacity() == 4);
+        for (int i = 0; i < 4; ++i) a.push_back(i);
+        assert(a.is_inline() && a.size() == 4);
+        a.push_back(4);                                  // spills to the heap
+        assert(!a.is_inline() && a.capacity() == 8);
+        for (int i = 0; i < 5; ++i) assert(a[i] == i);
+        assert(std::accumulate(a.begin(), a.end(), 0) == 10);
+
+        a.pop_back();
+        a.pop_back();
+        a.shrink_to_fit();                               // back inline
+        assert(a.is_inline() && a.size() == 3 && a[2] == 2);
+    }
+
+    // insert / erase on both storages
+    {
+        SmallDynamicArray<std::string, 2> s;
+        s.push_back("b");
+        s.insert(0, "a");                                // inline [a,b]
+        s.insert(2, "d");                                // heap   [a,b,d]
+        s.insert(2, std::string("c"));                   // [a,b,c,d]
+        assert(s.size() == 4 && s[0] == "a" && s[2] == "c" && s[3] == "d");
+        s.erase(1);                                      // [a,c,d]
+        assert(s.size() == 3 && s[1] == "c");
+        s.emplace_back(3, 'z');
+        assert(s[3] == "zzz");
+    }
+
+    // push_back of an element of the same array across the inline->heap spill
+    {
+        SmallDynamicArray<std::string, 2> s;
+        s.push_back("first element long enough to live on the heap");
+        s.push_back("x");
+        s.push_back(s[0]);
+        assert(s[2] == s[0]);
+    }
+
+    // insert of an element of the same array, in spare room and on growth
+    {
+        SmallDynamicArray<int, 4> b;
+        for (int i = 0; i < 4; ++i) b.push_back(i);
+        b.insert(0, b[1]);                               // grows: [1,0,1,2,3]
+        assert(b.size() == 5 && b[0] == 1 && b[1] == 0 && b[4] == 3);
+        b.insert(1, b[4]);                               // spare: [1,3,0,1,2,3]
+        assert(b.size() == 6 && b[1] == 3 && b[2] == 0 && b[5] == 3);
+
+        SmallDynamicArray<std::string, 2> s;
+        s.push_back(std::string(40, 'a'));
+        s.push_back(std::string(40, 'b'));
+        s.insert(0, s[1]);
+        s.insert(1, s[2]);
+        assert(s.size() == 4 && s[0][0] == 'b' && s[1][0] == 'b' && s[2][0] == 'a' && s[3][0] == 'b');
+    }
+
+    // copy and move, inline and heap
+    {
+        SmallDynamicArray<int, 4> in;
+        in.push_back(1);
+        in.push_back(2);
+        SmallDynamicArray<int, 4> heap;
+        for (int i = 0; i < 10; ++i) heap.push_back(i);
+
+        SmallDynamicArray<int, 4> c1(in), c2(heap);
+        assert(c1.is_inline() && c1.size() == 2 && c1[1] == 2);
+        assert(c2.size() == 10 && c2[9] == 9 && c2.data() != heap.data());
+
+        const int* buf = heap.data();
+        SmallDynamicArray<int, 4> m(std::move(heap));
+        assert(m.data() == buf && heap.empty() && heap.is_inline());
+
+        SmallDynamicArray<int, 4> m2(std::move(in));
+        assert(m2.is_inline() && m2.size() == 2 && in.empty());
+
+        m2 = c2;
+        assert(m2.size() == 10 && m2[5] == 5);
+        m2 = std::move(c1);
+        assert(m2.is_inline() && m2.size() == 2);
+    }
+
+    // every constructed element is destroyed
+    {
+        Counter::constructions = Counter::destructions = 0;
+        {
+            SmallDynamicArray<Counter, 3> a;
+            for (int i = 0; i < 10; ++i) a.emplace_back(i);
+            a.erase(0);
+            a.insert(1, Counter(42));
+            SmallDynamicArray<Counter, 3> b(std::move(a));
+            assert(b[1].val == 42);
+        }
+        assert(Counter::constructions == Counter::destructions);
+    }
+
+    // strong guarantee when the relocation during a spill throws
+    {
+        SmallDynamicArray<Thrower, 2> a;
+        a.push_back(Thrower(1));
+        a.push_back(Thrower(2));
+        Thrower::trigger = 2;                            // copying element 2 throws
+        bool threw = false;
+        try { a.push_back(Thrower(3)); } catch (int) { threw = true; }
+        assert(threw && a.size() == 2 && a.is_inline() && a[1].val == 2);
+        Thrower::trigger = -1;
+    }
+
+    // insert into spare room when shifting copies and a copy throws:
+    // the elements stay live and in place
+    {
+        SmallDynamicArray<Thrower, 4> a;
+        for (int i = 1; i <= 3; ++i) a.push_back(Thrower(i));
+        Thrower::trigger = 3;                            // building the new end slot
+        bool threw = false;
+        try { a.insert(0, Thrower(9)); } catch (int) { threw = true; }
+        Thrower::trigger = -1;
+        assert(threw && a.size() == 3 && a[0].val == 1 && a[2].val == 3);
+        a.insert(1, Thrower(9));
+        assert(a.size() == 4 && a[1].val == 9 && a[2].val == 2 && a[3].val == 3);
+        a.erase(0);
+        assert(a.size() == 3 && a[0].val == 9 && a[2].val == 3);
+    }
+
+    // a throwing constructor after the gap is opened closes it again
+    {
+        SmallDynamicArray<Relocatable, 4> a;
+        for (int i = 1; i <= 3; ++i) a.push_back(Relocatable(i));
+        Relocatable r(9);
+        Relocatable::copies_left = 1;                    // the temporary, then throw
+        bool threw = false;
+        try { a.insert(0, r); } catch (int) { threw = true; }
+        Relocatable::copies_left = 1 << 30;
+        assert(threw && a.size() == 3 && a[0].val == 1 && a[1].val == 2 && a[2].val == 3);
+        a.insert(0, r);
+        assert(a.size() == 4 && a[0].val == 9 && a[3].val == 3);
+    }
+
+    std::cout << "SmallDynamicArray tests passed.\n";
+    return 0;
+}
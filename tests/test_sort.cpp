@@ -0,0 +1,133 @@
+#include "../src/sort.hpp"
+#include <cassert>
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+struct Record {
+    std::uint32_t key;
+    std::uint32_t seq;                     // input position, to check stability
+};
+
+template <typename T>
+bool same(const DynamicArray<T>& a, const DynamicArray<T>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) if (!(a[i] == b[i])) return false;
+    return true;
+}
+
+template <typename T>
+void check_radix(DynamicArray<T> a) {
+    DynamicArray<T> expect = a;
+    std::sort(expect.begin(), expect.end());
+    sorting::radix_sort(a);
+    assert(same(a, expect));
+}
+
+int main(){
+    std::mt19937_64 rng(11);
+
+    // integer keys of every width and signedness, including the extremes
+    {
+        DynamicArray<std::uint32_t> u32;
+        DynamicArray<std::uint64_t> u64;
+        DynamicArray<std::int32_t> i32;
+        DynamicArray<std::int64_t> i64;
+        DynamicArray<std::int8_t> i8;
+        for (int i = 0; i < 20000; ++i) {
+            std::uint64_t r = rng();
+            u32.push_back(static_cast<std::uint32_t>(r));
+            u64.push_back(r);
+            i32.push_back(static_cast<std::int32_t>(r >> 7));
+            i64.push_back(static_cast<std::int64_t>(r));
+            i8.push_back(static_cast<std::int8_t>(r));
+        }
+        i32.push_back(std::numeric_limits<std::int32_t>::min());
+        i32.push_back(std::numeric_limits<std::int32_t>::max());
+        i64.push_back(std::numeric_limits<std::int64_t>::min());
+        u64.push_back(0);
+        check_radix(u32);
+        check_radix(u64);
+        check_radix(i32);
+        check_radix(i64);
+        check_radix(i8);
+    }
+
+    // floating point keys: negatives, zeros, infinities
+    {
+        DynamicArray<float> f;
+        DynamicArray<double> d;
+        for (int i = 0; i < 20000; ++i) {
+            double x = (static_cast<double>(rng() % 2000001) - 1000000.0) / 777.0;
+            f.push_back(static_cast<float>(x));
+            d.push_back(x);
+        }
+        f.push_back(std::numeric_limits<float>::infinity());
+        f.push_back(-std::numeric_limits<float>::infinity());
+        d.push_back(-std::numeric_limits<double>::infinity());
+        d.push_back(-0.0);
+        d.push_back(0.0);
+        check_radix(f);
+        check_radix(d);
+    }
+
+    // small inputs and inputs where passes are skipped
+    {
+        check_radix(DynamicArray<std::uint32_t>());
+        DynamicArray<std::uint32_t> one(1, 5u);
+        check_radix(one);
+        DynamicArray<std::uint64_t> same_high;
+        for (std::uint64_t i = 0; i < 1000; ++i) same_high.push_back((std::uint64_t(0xabc) << 40) | (rng() & 0xffff));
+        check_radix(same_high);
+        DynamicArray<std::uint32_t> all_equal(500, 42u);
+        check_radix(all_equal);
+    }
+
+    // key extractor on structs is stable, scratch is reusable
+    {
+        DynamicArray<Record> recs, scratch;
+        for (std::uint32_t i = 0; i < 30000; ++i) recs.push_back(Record{static_cast<std::uint32_t>(rng() % 100), i});
+        for (int round = 0; round < 2; ++round) {
+            sorting::radix_sort(recs, scratch, [](const Record& r){ return r.key; });
+            for (std::size_t i = 1; i < recs.size(); ++i) {
+                assert(recs[i - 1].key <= recs[i].key);
+                if (recs[i - 1].key == recs[i].key) assert(recs[i - 1].seq < recs[i].seq);
+            }
+            for (std::size_t i = 0; i < recs.size(); ++i) recs[i].seq = static_cast<std::uint32_t>(i);
+        }
+        // descending order through a negated signed key
+        sorting::radix_sort(recs, [](const Record& r){ return -static_cast<std::int64_t>(r.key); });
+        for (std::size_t i = 1; i < recs.size(); ++i) assert(recs[i - 1].key >= recs[i].key);
+    }
+
+    // parallel_sort with default and custom comparators, any thread count
+    {
+        for (std::size_t threads : {1u, 2u, 3u, 4u, 7u}) {
+            ThreadPool pool(threads);
+            for (std::size_t n : {0u, 10u, 5000u, 50000u, 100003u}) {
+                DynamicArray<std::uint64_t> a;
+                for (std::size_t i = 0; i < n; ++i) a.push_back(rng() % 100000);
+                DynamicArray<std::uint64_t> expect = a;
+                std::sort(expect.begin(), expect.end());
+                sorting::parallel_sort(pool, a);
+                assert(same(a, expect));
+
+                sorting::parallel_sort(pool, a, std::greater<>());
+                for (std::size_t i = 1; i < a.size(); ++i) assert(a[i - 1] >= a[i]);
+            }
+        }
+        ThreadPool pool(4);
+        DynamicArray<std::string> words;
+        for (int i = 0; i < 40000; ++i) words.push_back(std::to_string(rng() % 1000000));
+        DynamicArray<std::string> expect = words;
+        std::sort(expect.begin(), expect.end());
+        sorting::parallel_sort(pool, words);
+        assert(same(words, expect));
+    }
+
+    std::cout << "Sort tests passed.\n";
+    return 0;
+}
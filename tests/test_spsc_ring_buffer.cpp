@@ -0,0 +1,103 @@
+#include "../src/spsc_ring_buffer.hpp"
+#include "../src/dynamic_array.hpp"
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+
+int main(){
+    // capacity rounds up to a power of two; FIFO through the wrap-around
+    {
+        SpscRingBuffer<int> r(5);
+        assert(r.capacity() == 8 && r.empty_approx());
+        int out = 0;
+        assert(!r.try_pop(out));
+        for(int round = 0; round < 5; ++round){
+            for(int i = 0; i < 8; ++i) assert(r.try_push(round * 8 + i));
+            assert(!r.try_push(-1) && r.size_approx() == 8);
+            for(int i = 0; i < 5; ++i) assert(r.try_pop(out) && out == round * 8 + i);
+            for(int i = 5; i < 8; ++i) assert(r.try_pop(out) && out == round * 8 + i);
+            assert(!r.try_pop(out) && r.empty_approx());
+        }
+        SpscRingBuffer<int> one(1);
+        assert(one.capacity() == 1 && one.try_push(1) && !one.try_push(2));
+    }
+
+    // batches stop at what fits or what is there
+    {
+        SpscRingBuffer<int> r(8);
+        int in[20];
+        for(int i = 0; i < 20; ++i) in[i] = i;
+        assert(r.try_push_n(in, 0) == 0);
+        assert(r.try_push_n(in, 5) == 5);
+        assert(r.try_push_n(in + 5, 20) == 3);        // only 3 slots left
+        assert(r.try_push_n(in + 8, 1) == 0);
+        int out[20];
+        assert(r.try_pop_n(out, 0) == 0);
+        assert(r.try_pop_n(out, 6) == 6);
+        for(int i = 0; i < 6; ++i) assert(out[i] == i);
+        assert(r.try_push_n(in + 8, 12) == 6);        // wraps around the end
+        DynamicArray<int> rest;
+        assert(r.try_pop_n(std::back_inserter(rest), 100) == 8);
+        for(int i = 0; i < 8; ++i) assert(rest[i] == 6 + i);
+        assert(r.try_pop_n(out, 4) == 0);
+    }
+
+    // non-trivial elements: moved out, and leftovers freed by the destructor
+    {
+        auto counter = std::make_shared<int>(0);
+        {
+            SpscRingBuffer<std::shared_ptr<int>> r(4);
+            for(int i = 0; i < 3; ++i) assert(r.try_emplace(counter));
+            std::shared_ptr<int> p;
+            assert(r.try_pop(p) && p == counter);
+            assert(counter.use_count() == 4);
+        }
+        assert(counter.use_count() == 1);
+        SpscRingBuffer<std::string> s(2);
+        assert(s.try_push(std::string(40, 'x')) && s.try_push(std::string(50, 'y')));
+        std::string out;
+        assert(s.try_pop(out) && out == std::string(40, 'x'));
+    }
+
+    // one producer, one consumer, mixing single and batched operations:
+    // every value arrives once, in order
+    {
+        const int total = 200000;
+        SpscRingBuffer<int> r(64);
+        std::thread producer([&]{
+            int next = 0;
+            int batch[16];
+            while(next < total){
+                if(next % 3){
+                    if(r.try_push(next)) ++next;
+                }
+                else{
+                    int n = total - next < 16 ? total - next : 16;
+                    for(int i = 0; i < n; ++i) batch[i] = next + i;
+                    next += static_cast<int>(r.try_push_n(batch, n));
+                }
+            }
+        });
+        int expect = 0;
+        int batch[32];
+        bool in_order = true;
+        while(expect < total){
+            if(expect % 2){
+                int v;
+                if(r.try_pop(v)) in_order &= v == expect++;
+            }
+            else{
+                std::size_t k = r.try_pop_n(batch, 32);
+                for(std::size_t i = 0; i < k; ++i) in_order &= batch[i] == expect++;
+            }
+        }
+        producer.join();
+        assert(in_order && r.empty_approx());
+    }
+
+    std::cout << "SpscRingBuffer tests passed.\n";
+    return 0;
+}
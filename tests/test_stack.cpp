@@ -1,6 +1,7 @@
 #include "../src/stack.hpp"
 #include <cassert>
 #include <iostream>
+#include <string>
 
 int main(){
     Stack<int> st;
@@ -15,5 +16,40 @@ int main(){
     st.pop();
     assert(st.top() == 2);
 
+    // capacity stays at the high-water mark until shrink_to_fit
+    {
+        Stack<int> s;
+        for (int i = 0; i < 1000; ++i) s.push(i);
+        std::size_t high = s.capacity();
+        assert(high >= 1000);
+        while (!s.isEmpty()) s.pop();
+        assert(s.capacity() == high);
+        s.shrink_to_fit();
+        assert(s.capacity() == 0);
+
+        Stack<int, std::allocator<int>, DefaultGrowthPolicy> shrinking;
+        for (int i = 0; i < 1000; ++i) shrinking.push(i);
+        while (shrinking.size() > 1) shrinking.pop();
+        assert(shrinking.capacity() < 1000);
+    }
+
+    // reserve, push_n, pop_n
+    {
+        Stack<std::string> s;
+        s.reserve(64);
+        assert(s.capacity() >= 64 && s.isEmpty());
+        std::string words[] = {"a", "b", "c", "d", "e"};
+        s.push_n(words, words + 5);
+        assert(s.size() == 5 && s.top() == "e");
+        s.emplace(3, 'z');
+        assert(s.top() == "zzz");
+        s.pop_n(3);
+        assert(s.size() == 3 && s.top() == "c");
+        s.pop_n(0);
+        assert(s.size() == 3);
+        s.pop_n(3);
+        assert(s.isEmpty() && s.capacity() >= 64);
+    }
+
     std::cout<<"All stack tests passed";
-}
\ No newline at end of file
+}
@@ -0,0 +1,217 @@
+#include "../src/unrolled_linked_list.hpp"
+#include "../src/dynamic_array.hpp"
+#include "../src/allocators.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+struct Counter {
+    static int live;
+    int val;
+    Counter(int v = 0) : val(v) { ++live; }
+    Counter(const Counter& o) : val(o.val) { ++live; }
+    Counter(Counter&& o) noexcept : val(o.val) { ++live; o.val = -1; }
+    ~Counter() { --live; }
+};
+int Counter::live = 0;
+
+// copy-only and throws on demand
+struct Fragile {
+    static int copies_left;
+    int val;
+    Fragile(int v) : val(v) {}
+    Fragile(const Fragile& o) : val(o.val) {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+    }
+    Fragile& operator=(const Fragile& o) {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+        val = o.val;
+        return *this;
+    }
+};
+int Fragile::copies_left = 1 << 30;
+
+template <typename List>
+bool same(const List& l, const DynamicArray<int>& ref) {
+    if (l.size() != ref.size()) return false;
+    std::size_t i = 0;
+    for (const auto& v : l) {
+        if (static_cast<int>(v) != ref[i++]) return false;
+    }
+    return i == ref.size();
+}
+
+int main(){
+    // push_back packs full nodes; iteration visits everything in order
+    {
+        UnrolledLinkedList<int, 8> L;
+        assert(L.empty() && L.begin() == L.end());
+        for (int i = 0; i < 100; ++i) L.push_back(i);
+        assert(L.size() == 100 && L.node_count() == 13);
+        int x = 0;
+        for (int v : L) assert(v == x++);
+        assert(L.front() == 0 && L.back() == 99);
+        for (int i = 1; i <= 5; ++i) L.push_front(-i);
+        assert(L.front() == -5 && L.size() == 105);
+        L.pop_front();
+        L.pop_back();
+        assert(L.front() == -4 && L.back() == 98);
+    }
+
+    // insert into a full node splits it; erase refills from the successor
+    {
+        UnrolledLinkedList<int, 4> L;
+        for (int i = 0; i < 8; ++i) L.push_back(i);            // [0 1 2 3][4 5 6 7]
+        assert(L.node_count() == 2);
+        L.insert_at(1, 100);                                    // [0 100 1][2 3][4 5 6 7]
+        assert(L.node_count() == 3);
+        auto it = L.begin();
+        assert(*it++ == 0 && *it++ == 100 && *it++ == 1 && *it++ == 2);
+        L.erase_at(1);
+        L.erase_at(1);                                          // underfull: merge
+        assert(L.node_count() == 2);
+        DynamicArray<int> ref;
+        for (int i : {0, 2, 3, 4, 5, 6, 7}) ref.push_back(i);
+        assert(same(L, ref));
+    }
+
+    // iterator insert/erase return the right positions
+    {
+        UnrolledLinkedList<int, 4> L;
+        for (int i = 0; i < 10; ++i) L.push_back(i);
+        auto it = L.begin();
+        while (it != L.end()) {
+            if (*it % 2) it = L.erase(it);
+            else ++it;
+        }
+        DynamicArray<int> ref;
+        for (int i = 0; i < 10; i += 2) ref.push_back(i);
+        assert(same(L, ref));
+        for (auto i = L.begin(); i != L.end(); ++i) {
+            i = L.insert(i, *i + 100);                         // before each element
+            ++i;
+        }
+        assert(L.size() == 10 && L.front() == 100);
+        auto last = L.insert(L.end(), 42);
+        assert(*last == 42 && L.back() == 42);
+    }
+
+    // random operations against DynamicArray, element lifetimes balance
+    {
+        std::mt19937 rng(11);
+        {
+            UnrolledLinkedList<Counter, 6> L;
+            DynamicArray<int> ref;
+            for (int step = 0; step < 50000; ++step) {
+                unsigned op = rng() % 8;
+                int v = static_cast<int>(rng() % 1000);
+                if (op == 0 || ref.empty()) { L.push_back(Counter(v)); ref.push_back(v); }
+                else if (op == 1) { L.push_front(Counter(v)); ref.insert(0, v); }
+                else if (op <= 3) {
+                    std::size_t i = rng() % (ref.size() + 1);
+                    L.emplace_at(i, v);
+                    ref.insert(i, v);
+                }
+                else if (op <= 5) {
+                    std::size_t i = rng() % ref.size();
+                    L.erase_at(i);
+                    ref.erase(i);
+                }
+                else if (op == 6) { L.pop_back(); ref.pop_back(); }
+                else { L.pop_front(); ref.erase(0); }
+                assert(L.size() == ref.size());
+                if (step % 1000 == 0) {
+                    std::size_t i = 0;
+                    for (const Counter& c : L) assert(c.val == ref[i++]);
+                    if (!ref.empty()) assert(L.locate(ref.size() / 3)->val == ref[ref.size() / 3]);
+                }
+            }
+            std::size_t i = 0;
+            for (const Counter& c : L) assert(c.val == ref[i++]);
+            assert(Counter::live == static_cast<int>(L.size()));
+        }
+        assert(Counter::live == 0);
+    }
+
+    // inserting an element of the list itself, copies and moves
+    {
+        UnrolledLinkedList<std::string, 4> L;
+        for (int i = 0; i < 4; ++i) L.push_back(std::to_string(i) + " padding past SSO");
+        L.insert_at(0, *L.locate(3));                          // splits the node it refers to
+        L.push_front(L.back());
+        assert(*L.locate(0) == "3 padding past SSO" && *L.locate(1) == "3 padding past SSO");
+
+        UnrolledLinkedList<std::string, 4> copy(L);
+        assert(copy.size() == 6 && copy.front() == L.front());
+        UnrolledLinkedList<std::string, 4> moved(std::move(copy));
+        assert(copy.empty() && moved.size() == 6);
+        copy = moved;
+        assert(copy.size() == 6 && copy.back() == "3 padding past SSO");
+        moved = std::move(L);
+        assert(L.empty() && moved.size() == 6);
+        L.push_back("reused");
+        assert(L.size() == 1);
+    }
+
+    // a throwing construction leaves the list unchanged
+    {
+        UnrolledLinkedList<Fragile, 4> L;
+        for (int i = 0; i < 8; ++i) L.push_back(Fragile(i));
+        Fragile f(99);
+        Fragile::copies_left = 0;
+        bool caught = false;
+        try { L.insert_at(2, f); } catch (const std::runtime_error&) { caught = true; }
+        assert(caught && L.size() == 8);
+        caught = false;
+        Fragile::copies_left = 0;
+        try { L.push_back(f); } catch (const std::runtime_error&) { caught = true; }
+        assert(caught && L.size() == 8 && L.node_count() == 2);
+        Fragile::copies_left = 1 << 30;
+        int x = 0;
+        for (const Fragile& v : L) assert(v.val == x++);
+    }
+
+    // shifting inside a node copies; a copy failing halfway leaves no hole
+    {
+        UnrolledLinkedList<Fragile, 4> L;
+        for (int i = 0; i < 6; ++i) L.push_back(Fragile(i));   // [0,1,2,3] [4,5]
+        Fragile f(99);
+        Fragile::copies_left = 2;                 // temporary, new end slot, then throw
+        bool caught = false;
+        try { L.insert_at(4, f); } catch (const std::runtime_error&) { caught = true; }
+        Fragile::copies_left = 1 << 30;
+        std::size_t n = 0;
+        for (const Fragile& v : L) { (void)v; ++n; }
+        assert(caught && L.size() == 7 && n == 7);
+
+        Fragile::copies_left = 0;
+        caught = false;
+        try { L.erase_at(4); } catch (const std::runtime_error&) { caught = true; }
+        Fragile::copies_left = 1 << 30;
+        assert(caught && L.size() == 7);
+
+        L.erase_at(5);
+        L.erase_at(4);
+        L.insert_at(4, f);                        // [0,1,2,3] [99,5]
+        L.erase_at(1);
+        DynamicArray<int> ref;
+        for (int v : {0, 2, 3, 99, 5}) ref.push_back(v);
+        std::size_t i = 0;
+        for (const Fragile& v : L) assert(v.val == ref[i++]);
+        assert(i == 5 && L.size() == 5);
+    }
+
+    // pooled nodes
+    {
+        UnrolledLinkedList<int, 16, NodePoolAllocator<int>> L;
+        for (int i = 0; i < 1000; ++i) L.push_back(i);
+        while (L.size() > 10) L.pop_back();
+        for (int i = 0; i < 1000; ++i) L.push_back(i);
+        assert(L.size() == 1010 && L.get_allocator().resource()->block_size() > 16 * sizeof(int));
+    }
+
+    std::cout << "UnrolledLinkedList tests passed.\n";
+    return 0;
+}